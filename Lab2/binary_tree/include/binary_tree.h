@@ -10,15 +10,38 @@ typedef char TElemType;
  * @param data 数据
  * @param lchild 左孩子
  * @param rchild 右孩子
+ * @param bf 平衡因子（仅平衡二叉树使用，左高为LH，等高为EH，右高为RH）
  *
  */
 typedef struct BiTNode
 {
     TElemType data;
     struct BiTNode *lchild, *rchild;
-    BiTNode(TElemType x) : data(x), lchild(nullptr), rchild(nullptr) {}
+    int bf;
+    BiTNode(TElemType x) : data(x), lchild(nullptr), rchild(nullptr), bf(0) {}
 } BiTNode, *BiTree;
 
+#define LH +1 // 左高
+#define EH 0  // 等高
+#define RH -1 // 右高
+
+/**
+ * @brief 二叉树统计信息
+ * @param degree degree[d] 为度为d的结点数
+ * @param size 结点总数
+ * @param height 树高（与High一致，空树为0）
+ * @param leafDepth leafDepth[d] 为深度为d（根深度为0）的叶子数
+ *
+ */
+struct TreeStats
+{
+    long long degree[3];
+    long long size;
+    int height;
+    std::vector<long long> leafDepth;
+    TreeStats() : degree{0, 0, 0}, size(0), height(0) {}
+};
+
 BiTree buildTree(const std::vector<std::string> &preorder, int &index, const std::string &nullSymbol);
 void generateDot(BiTree node, std::ofstream &ofs);
 void CreateBiTree(BiTree &T, const std::vector<std::string> &preorder, const std::string &nullSymbol);
@@ -26,8 +49,16 @@ void PreOrderTraverse(BiTree T);
 void InOrderTraverse(BiTree T);
 void PostOrderTraverse(BiTree T);
 void generateDotAndPng(BiTree root, const std::string &dotFilename, const std::string &pngFilename);
+void generateSvg(BiTree root, std::string &svg);
+void generateSvgFile(BiTree root, const std::string &svgFilename);
+void generateSvgBatch(const std::vector<BiTree> &roots, std::vector<std::string> &svgs);
 int TNodes(BiTree T, int d);
 int High(BiTree T);
-void CreateBST(BiTree &T, const char *chars);
+void TreeStatistics(BiTree T, TreeStats &stats);
+void TreeStatisticsParallel(BiTree T, TreeStats &stats, int threads = 0);
+void InsertBST(BiTree &T, TElemType data);
+bool InsertAVL(BiTree &T, TElemType data, bool &taller);
+void CreateBST(BiTree &T, const char *chars, bool balanced = false);
+void CreateBalancedBST(BiTree &T, const char *sorted);
 
 #endif // BINARY_TREE_H
\ No newline at end of file
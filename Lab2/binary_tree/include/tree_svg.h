@@ -0,0 +1,37 @@
+#ifndef TREE_SVG_H
+#define TREE_SVG_H
+
+#include <vector>
+#include <string>
+
+/**
+ * @brief 扁平化的二叉树，供布局与SVG渲染使用
+ * @param lchild lchild[i] 为结点i的左孩子下标，-1表示空
+ * @param rchild rchild[i] 为结点i的右孩子下标，-1表示空
+ * @param label label[i] 为结点i显示的字符
+ *
+ * 结点按先序编号，0为根结点，孩子的下标总大于双亲的下标。
+ */
+struct SvgTree
+{
+    std::vector<int> lchild, rchild;
+    std::vector<char> label;
+    void clear()
+    {
+        lchild.clear();
+        rchild.clear();
+        label.clear();
+    }
+    int addNode(char c)
+    {
+        lchild.push_back(-1);
+        rchild.push_back(-1);
+        label.push_back(c);
+        return static_cast<int>(label.size()) - 1;
+    }
+};
+
+void LayoutTree(const SvgTree &t, std::vector<double> &x, std::vector<int> &depth);
+void RenderTreeSvg(const SvgTree &t, std::string &out);
+
+#endif // TREE_SVG_H
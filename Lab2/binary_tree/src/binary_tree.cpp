@@ -1,6 +1,10 @@
 #include "binary_tree.h"
+#include "tree_svg.h"
 #include <iostream>
 #include <fstream>
+#include <atomic>
+#include <thread>
+#include <utility>
 
 /**
  * 根据前序遍历序列构建二叉树
@@ -169,6 +173,100 @@ void generateDotAndPng(BiTree root, const std::string &dotFilename, const std::s
     system(command.c_str());
 }
 
+/**
+ * 将二叉树按先序扁平化（非递归）
+ * @param root 二叉树根节点
+ * @param t 扁平化结果
+ * @return void
+ *
+ * 算法实现:
+ * 1. 使用显式栈保存(结点, 双亲下标, 是否右孩子)，先压右孩子后压左孩子，出栈顺序即先序。
+ * 2. 每出栈一个结点分配下标，并回填到双亲的lchild或rchild。
+ */
+static void flattenTree(BiTree root, SvgTree &t)
+{
+    t.clear();
+    if (!root)
+        return;
+    struct Item
+    {
+        BiTree node;
+        int parent;
+        bool right;
+    };
+    std::vector<Item> s;
+    s.push_back({root, -1, false});
+    while (!s.empty())
+    {
+        Item it = s.back();
+        s.pop_back();
+        int id = t.addNode(it.node->data);
+        if (it.parent >= 0)
+            (it.right ? t.rchild : t.lchild)[it.parent] = id;
+        if (it.node->rchild)
+            s.push_back({it.node->rchild, id, true});
+        if (it.node->lchild)
+            s.push_back({it.node->lchild, id, false});
+    }
+}
+
+/**
+ * 在进程内生成二叉树的SVG图像
+ * @param root 二叉树根节点
+ * @param svg SVG文本输出缓冲区
+ * @return void
+ *
+ * 算法实现:
+ * 1. 非递归扁平化二叉树。
+ * 2. 调用RenderTreeSvg按Reingold–Tilford布局直接生成SVG文本，不依赖外部dot程序。
+ */
+void generateSvg(BiTree root, std::string &svg)
+{
+    SvgTree t;
+    flattenTree(root, t);
+    svg.clear();
+    RenderTreeSvg(t, svg);
+}
+
+/**
+ * 生成二叉树的SVG文件
+ * @param root 二叉树根节点
+ * @param svgFilename SVG文件名
+ * @return void
+ *
+ * 算法实现:
+ * 1. 调用generateSvg生成SVG文本。
+ * 2. 一次性写入文件。
+ */
+void generateSvgFile(BiTree root, const std::string &svgFilename)
+{
+    std::string svg;
+    generateSvg(root, svg);
+    std::ofstream ofs(svgFilename, std::ios::binary);
+    ofs.write(svg.data(), static_cast<std::streamsize>(svg.size()));
+}
+
+/**
+ * 批量生成多棵二叉树的SVG图像
+ * @param roots 二叉树根节点数组
+ * @param svgs 输出的SVG文本数组，与roots一一对应
+ * @return void
+ *
+ * 算法实现:
+ * 1. 复用同一个扁平化缓冲区，依次扁平化并渲染每棵树，避免逐棵重新分配。
+ */
+void generateSvgBatch(const std::vector<BiTree> &roots, std::vector<std::string> &svgs)
+{
+    SvgTree t;
+    svgs.resize(roots.size());
+    for (size_t i = 0; i < roots.size(); ++i)
+    {
+        flattenTree(roots[i], t);
+        svgs[i].clear();
+        RenderTreeSvg(t, svgs[i]);
+    }
+}
+
 /**
  * 统计二叉树中度为d的节点数
  * @param T 二叉树根节点
@@ -216,6 +314,153 @@ int High(BiTree T)
     return std::max(leftHeight, rightHeight) + 1;
 }
 
+/**
+ * 以base为根深度累计子树统计信息（非递归）
+ * @param T 子树根节点
+ * @param base 子树根节点在整棵树中的深度
+ * @param stats 累计结果
+ * @return void
+ *
+ * 算法实现:
+ * 1. 使用显式栈保存(结点, 深度)，避免深树递归栈溢出。
+ * 2. 每访问一个结点，一次性累计其度、结点数和叶子深度，叶子深度同时决定树高。
+ */
+static void accumulateStats(BiTree T, int base, TreeStats &stats)
+{
+    if (!T)
+        return;
+    std::vector<std::pair<BiTree, int>> s;
+    s.push_back({T, base});
+    while (!s.empty())
+    {
+        BiTree node = s.back().first;
+        int depth = s.back().second;
+        s.pop_back();
+        int d = (node->lchild != nullptr) + (node->rchild != nullptr);
+        stats.degree[d]++;
+        stats.size++;
+        if (d == 0)
+        {
+            if (stats.leafDepth.size() <= static_cast<size_t>(depth))
+                stats.leafDepth.resize(depth + 1, 0);
+            stats.leafDepth[depth]++;
+        }
+        if (node->rchild)
+            s.push_back({node->rchild, depth + 1});
+        if (node->lchild)
+            s.push_back({node->lchild, depth + 1});
+    }
+    stats.height = static_cast<int>(stats.leafDepth.size());
+}
+
+/**
+ * 合并两份统计信息
+ * @param dst 目标统计信息
+ * @param src 待合并的统计信息
+ * @return void
+ */
+static void mergeStats(TreeStats &dst, const TreeStats &src)
+{
+    for (int d = 0; d < 3; ++d)
+        dst.degree[d] += src.degree[d];
+    dst.size += src.size;
+    if (dst.leafDepth.size() < src.leafDepth.size())
+        dst.leafDepth.resize(src.leafDepth.size(), 0);
+    for (size_t i = 0; i < src.leafDepth.size(); ++i)
+        dst.leafDepth[i] += src.leafDepth[i];
+    dst.height = static_cast<int>(dst.leafDepth.size());
+}
+
+/**
+ * 单次遍历统计二叉树的各度结点数、结点总数、树高和叶子深度分布
+ * @param T 二叉树根节点
+ * @param stats 统计结果
+ * @return void
+ *
+ * 算法实现:
+ * 1. 清空统计结果。
+ * 2. 调用accumulateStats从根深度0开始非递归遍历一次，代替分别调用TNodes(T, 0/1/2)和High(T)的多次遍历。
+ */
+void TreeStatistics(BiTree T, TreeStats &stats)
+{
+    stats = TreeStats();
+    accumulateStats(T, 0, stats);
+}
+
+/**
+ * 多线程统计二叉树信息（fork-join）
+ * @param T 二叉树根节点
+ * @param stats 统计结果
+ * @param threads 线程数，0表示使用硬件并发数
+ * @return void
+ *
+ * 算法实现:
+ * 1. 从根开始按层展开，展开的上层结点由主线程直接计入统计，直到待处理子树数达到线程数的若干倍。
+ * 2. 各线程通过原子下标动态领取子树，以子树根的深度为基准调用accumulateStats，累加到线程栈上的统计信息，
+ *    领取结束后才写回local[t]一次，避免相邻线程的计数落在同一缓存行上造成伪共享。
+ * 3. 所有线程结束后合并私有统计信息。
+ * 4. 对退化为链的树无法展开出足够子树，此时自然退化为单线程遍历。
+ */
+void TreeStatisticsParallel(BiTree T, TreeStats &stats, int threads)
+{
+    stats = TreeStats();
+    if (!T)
+        return;
+    if (threads <= 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    if (threads == 1)
+    {
+        accumulateStats(T, 0, stats);
+        return;
+    }
+
+    // 按层展开出足够多的子树，展开过的结点由主线程计入
+    const size_t target = static_cast<size_t>(threads) * 8;
+    std::vector<std::pair<BiTree, int>> frontier, next;
+    frontier.push_back({T, 0});
+    while (!frontier.empty() && frontier.size() < target)
+    {
+        next.clear();
+        for (auto &item : frontier)
+        {
+            BiTree node = item.first;
+            int d = (node->lchild != nullptr) + (node->rchild != nullptr);
+            stats.degree[d]++;
+            stats.size++;
+            if (d == 0)
+            {
+                if (stats.leafDepth.size() <= static_cast<size_t>(item.second))
+                    stats.leafDepth.resize(item.second + 1, 0);
+                stats.leafDepth[item.second]++;
+            }
+            if (node->lchild)
+                next.push_back({node->lchild, item.second + 1});
+            if (node->rchild)
+                next.push_back({node->rchild, item.second + 1});
+        }
+        frontier.swap(next);
+    }
+
+    std::vector<TreeStats> local(threads);
+    std::atomic<size_t> cursor(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t]()
+                             {
+            TreeStats acc;
+            size_t i;
+            while ((i = cursor.fetch_add(1)) < frontier.size())
+                accumulateStats(frontier[i].first, frontier[i].second, acc);
+            local[t] = std::move(acc); });
+    }
+    for (auto &w : workers)
+        w.join();
+    for (auto &l : local)
+        mergeStats(stats, l);
+    stats.height = static_cast<int>(stats.leafDepth.size());
+}
+
 /**
  * 插入节点到二叉搜索树
  * @param T 二叉搜索树根节点的引用
@@ -240,21 +485,275 @@ void InsertBST(BiTree &T, TElemType data)
         InsertBST(T->rchild, data);
 }
 
+/**
+ * 对以p为根的子树作右旋处理
+ * @param p 子树根节点的引用，处理后指向新的根节点
+ * @return void
+ *
+ * 算法实现:
+ * 1. lc指向p的左孩子，lc的右子树挂接为p的左子树。
+ * 2. p挂接为lc的右孩子，p指向新的根节点lc。
+ */
+static void R_Rotate(BiTree &p)
+{
+    BiTree lc = p->lchild;
+    p->lchild = lc->rchild;
+    lc->rchild = p;
+    p = lc;
+}
+
+/**
+ * 对以p为根的子树作左旋处理
+ * @param p 子树根节点的引用，处理后指向新的根节点
+ * @return void
+ *
+ * 算法实现:
+ * 1. rc指向p的右孩子，rc的左子树挂接为p的右子树。
+ * 2. p挂接为rc的左孩子，p指向新的根节点rc。
+ */
+static void L_Rotate(BiTree &p)
+{
+    BiTree rc = p->rchild;
+    p->rchild = rc->lchild;
+    rc->lchild = p;
+    p = rc;
+}
+
+/**
+ * 对以T为根的子树作左平衡旋转处理
+ * @param T 子树根节点的引用，处理后指向新的根节点
+ * @return void
+ *
+ * 算法实现:
+ * 1. 若新结点插入在T左孩子的左子树上（LL型），作单向右旋。
+ * 2. 若新结点插入在T左孩子的右子树上（LR型），先对左子树左旋，再对T右旋，并按rd的平衡因子修正各结点的平衡因子。
+ */
+static void LeftBalance(BiTree &T)
+{
+    BiTree lc = T->lchild;
+    switch (lc->bf)
+    {
+    case LH:
+        T->bf = lc->bf = EH;
+        R_Rotate(T);
+        break;
+    case RH:
+    {
+        BiTree rd = lc->rchild;
+        switch (rd->bf)
+        {
+        case LH:
+            T->bf = RH;
+            lc->bf = EH;
+            break;
+        case EH:
+            T->bf = lc->bf = EH;
+            break;
+        case RH:
+            T->bf = EH;
+            lc->bf = LH;
+            break;
+        }
+        rd->bf = EH;
+        L_Rotate(T->lchild);
+        R_Rotate(T);
+        break;
+    }
+    }
+}
+
+/**
+ * 对以T为根的子树作右平衡旋转处理
+ * @param T 子树根节点的引用，处理后指向新的根节点
+ * @return void
+ *
+ * 算法实现:
+ * 1. 若新结点插入在T右孩子的右子树上（RR型），作单向左旋。
+ * 2. 若新结点插入在T右孩子的左子树上（RL型），先对右子树右旋，再对T左旋，并按ld的平衡因子修正各结点的平衡因子。
+ */
+static void RightBalance(BiTree &T)
+{
+    BiTree rc = T->rchild;
+    switch (rc->bf)
+    {
+    case RH:
+        T->bf = rc->bf = EH;
+        L_Rotate(T);
+        break;
+    case LH:
+    {
+        BiTree ld = rc->lchild;
+        switch (ld->bf)
+        {
+        case RH:
+            T->bf = LH;
+            rc->bf = EH;
+            break;
+        case EH:
+            T->bf = rc->bf = EH;
+            break;
+        case LH:
+            T->bf = EH;
+            rc->bf = RH;
+            break;
+        }
+        ld->bf = EH;
+        R_Rotate(T->rchild);
+        L_Rotate(T);
+        break;
+    }
+    }
+}
+
+/**
+ * 插入节点到平衡二叉树（AVL树）
+ * @param T 平衡二叉树根节点的引用
+ * @param data 插入的数据
+ * @param taller 返回插入后子树是否长高
+ * @return 插入成功返回true，已存在相同关键字返回false
+ *
+ * 算法实现:
+ * 1. 如果当前节点为空，创建新节点，树长高。
+ * 2. 如果数据已存在，不插入。
+ * 3. 否则递归插入到左子树或右子树，若子树长高则根据当前节点的平衡因子调整：
+ *    a. 原本一侧偏高而插入在该侧，作平衡旋转处理，树高不变。
+ *    b. 原本等高，平衡因子改为偏向插入侧，树长高。
+ *    c. 原本另一侧偏高，平衡因子改为等高，树高不变。
+ * 4. 每次插入最多作一次（单或双）旋转，树高保持O(log n)。
+ */
+bool InsertAVL(BiTree &T, TElemType data, bool &taller)
+{
+    if (!T)
+    {
+        T = new BiTNode(data);
+        T->bf = EH;
+        taller = true;
+        return true;
+    }
+    if (data == T->data)
+    {
+        taller = false;
+        return false;
+    }
+    if (data < T->data)
+    {
+        if (!InsertAVL(T->lchild, data, taller))
+            return false;
+        if (taller)
+        {
+            switch (T->bf)
+            {
+            case LH:
+                LeftBalance(T);
+                taller = false;
+                break;
+            case EH:
+                T->bf = LH;
+                taller = true;
+                break;
+            case RH:
+                T->bf = EH;
+                taller = false;
+                break;
+            }
+        }
+    }
+    else
+    {
+        if (!InsertAVL(T->rchild, data, taller))
+            return false;
+        if (taller)
+        {
+            switch (T->bf)
+            {
+            case LH:
+                T->bf = EH;
+                taller = false;
+                break;
+            case EH:
+                T->bf = RH;
+                taller = true;
+                break;
+            case RH:
+                RightBalance(T);
+                taller = false;
+                break;
+            }
+        }
+    }
+    return true;
+}
+
 /**
  * 创建二叉搜索树
  * @param T 二叉搜索树根节点的引用
  * @param chars 插入的字符数组
+ * @param balanced 是否按平衡二叉树（AVL树）方式插入
  * @return void
  *
  * 算法实现:
  * 1. 初始化二叉搜索树为空。
  * 2. 遍历字符数组，依次插入每个字符到二叉搜索树。
+ * 3. 若balanced为true，使用InsertAVL插入，有序输入下树高仍为O(log n)。
  */
-void CreateBST(BiTree &T, const char *chars)
+void CreateBST(BiTree &T, const char *chars, bool balanced)
 {
     T = nullptr;
+    bool taller = false;
     for (int i = 0; chars[i] != '\0'; ++i)
     {
-        InsertBST(T, chars[i]);
+        if (balanced)
+            InsertAVL(T, chars[i], taller);
+        else
+            InsertBST(T, chars[i]);
+    }
+}
+
+/**
+ * 由有序序列[lo, hi)构建完全平衡的子树
+ * @param sorted 严格递增的字符数组
+ * @param lo 区间起点
+ * @param hi 区间终点（不含）
+ * @param height 返回子树高度
+ * @return 子树根节点
+ *
+ * 算法实现:
+ * 1. 取区间中点作为根节点。
+ * 2. 递归构建左半区间和右半区间，并由左右子树高度差设置平衡因子。
+ */
+static BiTree buildBalanced(const char *sorted, int lo, int hi, int &height)
+{
+    if (lo >= hi)
+    {
+        height = 0;
+        return nullptr;
     }
+    int mid = lo + (hi - lo) / 2;
+    int lh, rh;
+    BiTree node = new BiTNode(sorted[mid]);
+    node->lchild = buildBalanced(sorted, lo, mid, lh);
+    node->rchild = buildBalanced(sorted, mid + 1, hi, rh);
+    node->bf = lh - rh;
+    height = std::max(lh, rh) + 1;
+    return node;
+}
+
+/**
+ * 由有序字符数组批量创建平衡二叉搜索树
+ * @param T 二叉搜索树根节点的引用
+ * @param sorted 严格递增的字符数组
+ * @return void
+ *
+ * 算法实现:
+ * 1. 计算数组长度n。
+ * 2. 以中点为根递归二分构建，每个元素只访问一次，总代价O(n)，树高为⌈log2(n+1)⌉。
+ * 3. 构建出的树平衡因子均已设置，可继续用InsertAVL插入。
+ */
+void CreateBalancedBST(BiTree &T, const char *sorted)
+{
+    int n = 0;
+    while (sorted[n] != '\0')
+        ++n;
+    int height;
+    T = buildBalanced(sorted, 0, n, height);
 }
\ No newline at end of file
@@ -1,8 +1,11 @@
 #include "binary_tree.h"
 #include "ui.h"
 #include <iostream>
+#include <fstream>
 #include <vector>
 #include <string>
+#include <chrono>
+#include <algorithm>
 
 int main()
 {
@@ -37,6 +40,54 @@ int main()
     std::cout << "\033[32mTNodes(T, 0) = " << TNodes(root, 0) << "\033[0m" << std::endl; // 绿色
     std::cout << "\033[33mTNodes(T, 1) = " << TNodes(root, 1) << "\033[0m" << std::endl; // 黄色
     std::cout << "\033[31mTNodes(T, 2) = " << TNodes(root, 2) << "\033[0m" << std::endl; // 红色
+    // TreeStatistics(T)单次遍历同时得到各度结点数、结点总数、树高和叶子深度分布。
+    TreeStats stats;
+    TreeStatistics(root, stats);
+    std::cout << "TreeStatistics: n0 = " << stats.degree[0] << ", n1 = " << stats.degree[1]
+              << ", n2 = " << stats.degree[2] << ", size = " << stats.size << ", height = " << stats.height << std::endl;
+    std::cout << "叶子深度分布: ";
+    for (size_t d = 0; d < stats.leafDepth.size(); ++d)
+        std::cout << "[" << d << "]=" << stats.leafDepth[d] << " ";
+    std::cout << std::endl;
+    // 大树上比较单线程与多线程统计：每个新结点从根随机向下走到空位置插入
+    BiTree big = new BiTNode('A');
+    unsigned long long seed = 88172645463325252ull;
+    for (int i = 1; i < 2000000; ++i)
+    {
+        BiTree *slot = &big;
+        while (*slot)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            slot = (seed & 1) ? &(*slot)->lchild : &(*slot)->rchild;
+        }
+        *slot = new BiTNode('A' + i % 26);
+    }
+    TreeStats serial, parallel;
+    auto t0 = std::chrono::steady_clock::now();
+    TreeStatistics(big, serial);
+    auto t1 = std::chrono::steady_clock::now();
+    TreeStatisticsParallel(big, parallel);
+    auto t2 = std::chrono::steady_clock::now();
+    bool same = serial.size == parallel.size && serial.height == parallel.height &&
+                serial.leafDepth == parallel.leafDepth &&
+                std::equal(serial.degree, serial.degree + 3, parallel.degree);
+    std::cout << "大树(" << serial.size << " 个结点, 高 " << serial.height << "): TreeStatistics "
+              << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms, TreeStatisticsParallel "
+              << std::chrono::duration<double, std::milli>(t2 - t1).count() << " ms, 结果"
+              << (same ? "一致" : "不一致") << std::endl;
+    std::vector<BiTree> pending = {big};
+    while (!pending.empty())
+    {
+        BiTree node = pending.back();
+        pending.pop_back();
+        if (node->lchild)
+            pending.push_back(node->lchild);
+        if (node->rchild)
+            pending.push_back(node->rchild);
+        delete node;
+    }
     // 调用CreateBST(T1,"DBFCAEG")，CreateBST(T2,"ABCDEFG")，创建两棵二叉树，对它们进行中序遍历，并调用High()函数输出其高度。分析比较其结果。
     BiTree T1 = nullptr, T2 = nullptr;
     CreateBST(T1, "DBFCAEG");
@@ -49,10 +100,27 @@ int main()
     InOrderTraverse(T2);
     std::cout << std::endl;
     std::cout << "T2的高度: " << High(T2) << std::endl;
+    // 对有序序列分别使用AVL插入和有序批量构建，比较其高度。
+    BiTree T3 = nullptr, T4 = nullptr;
+    CreateBST(T3, "ABCDEFG", true);
+    CreateBalancedBST(T4, "ABCDEFG");
+    std::cout << "递归中序遍历 T3 (AVL): " << std::endl;
+    InOrderTraverse(T3);
+    std::cout << std::endl;
+    std::cout << "T3的高度: " << High(T3) << std::endl;
+    std::cout << "T4 (有序批量构建) 的高度: " << High(T4) << std::endl;
 
-    generateDotAndPng(root, "root.dot", "root.png");
-    generateDotAndPng(T1, "T1.dot", "T1.png");
-    generateDotAndPng(T2, "T2.dot", "T2.png");
+    // 在进程内批量生成SVG图像，不再调用外部dot程序
+    std::vector<BiTree> trees = {root, T1, T2};
+    std::vector<std::string> names = {"root.svg", "T1.svg", "T2.svg"};
+    std::vector<std::string> svgs;
+    generateSvgBatch(trees, svgs);
+    for (size_t i = 0; i < trees.size(); ++i)
+    {
+        std::ofstream ofs(names[i]);
+        ofs << svgs[i];
+        std::cout << "二叉树的图像已生成：" << names[i] << std::endl;
+    }
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,227 @@
+#include "tree_svg.h"
+#include <algorithm>
+#include <cstdio>
+
+// 布局与绘制参数
+static const double MIN_SEP = 1.0;   // 同层相邻结点的最小水平间距（单位）
+static const double UNIT = 40.0;     // 一个水平单位对应的像素
+static const double LEVEL_GAP = 60.0; // 相邻层的垂直间距（像素）
+static const double RADIUS = 15.0;   // 结点半径（像素）
+static const double MARGIN = 25.0;   // 画布边距（像素）
+
+/**
+ * 子树轮廓
+ * @param lo lo[k] 为子树某层最左结点的横坐标
+ * @param hi hi[k] 为子树某层最右结点的横坐标
+ * @param shift 整体平移量，实际坐标为存储值加shift
+ *
+ * 各层按从最深层到子树根的顺序存放，合并时只需在尾部追加根所在层。
+ */
+struct Contour
+{
+    std::vector<double> lo, hi;
+    double shift;
+    Contour() : shift(0) {}
+};
+
+/**
+ * 合并左右子树轮廓并求左右孩子相对双亲的偏移
+ * @param L 左子树轮廓
+ * @param R 右子树轮廓
+ * @param offL 返回左孩子相对双亲的偏移
+ * @param offR 返回右孩子相对双亲的偏移
+ * @param out 返回合并后的轮廓（以双亲为原点，尚未包含双亲所在层）
+ *
+ * 算法实现:
+ * 1. 自上而下比较两棵子树共有的层，求使左子树右轮廓与右子树左轮廓在每层都至少相隔MIN_SEP的根间距s。
+ * 2. 左右孩子分别偏移-s/2和+s/2。
+ * 3. 沿用较高子树的轮廓数组，只改写共有层中另一侧的边界，代价为O(较矮子树高度)。
+ */
+static void mergeContour(Contour &L, Contour &R, double &offL, double &offR, Contour &out)
+{
+    size_t hL = L.lo.size(), hR = R.lo.size();
+    size_t common = std::min(hL, hR);
+    double s = MIN_SEP;
+    for (size_t k = 0; k < common; ++k)
+    {
+        double need = MIN_SEP + (L.hi[hL - 1 - k] + L.shift) - (R.lo[hR - 1 - k] + R.shift);
+        s = std::max(s, need);
+    }
+    offL = -s / 2;
+    offR = s / 2;
+    if (hL >= hR)
+    {
+        double shift = L.shift + offL;
+        for (size_t k = 0; k < common; ++k)
+            L.hi[hL - 1 - k] = R.hi[hR - 1 - k] + R.shift + offR - shift;
+        out.lo.swap(L.lo);
+        out.hi.swap(L.hi);
+        out.shift = shift;
+    }
+    else
+    {
+        double shift = R.shift + offR;
+        for (size_t k = 0; k < common; ++k)
+            R.lo[hR - 1 - k] = L.lo[hL - 1 - k] + L.shift + offL - shift;
+        out.lo.swap(R.lo);
+        out.hi.swap(R.hi);
+        out.shift = shift;
+    }
+    std::vector<double>().swap(L.lo);
+    std::vector<double>().swap(L.hi);
+    std::vector<double>().swap(R.lo);
+    std::vector<double>().swap(R.hi);
+}
+
+/**
+ * Reingold–Tilford布局（非递归）
+ * @param t 扁平化的二叉树
+ * @param x 返回各结点的横坐标（单位，最左结点为0）
+ * @param depth 返回各结点的深度（根为0）
+ *
+ * 算法实现:
+ * 1. 结点按先序编号，逆序扫描即为孩子先于双亲的后序，无需递归或显式栈。
+ * 2. 对每个结点合并左右子树轮廓，求孩子相对双亲的偏移；只有一个孩子时该孩子向其一侧偏移MIN_SEP/2，保留左右关系。
+ * 3. 正序扫描，由双亲坐标加偏移得到孩子的绝对坐标，并平移使最左结点坐标为0。
+ * 4. 轮廓合并总代价为O(n)，整个布局为O(n)。
+ */
+void LayoutTree(const SvgTree &t, std::vector<double> &x, std::vector<int> &depth)
+{
+    int n = static_cast<int>(t.label.size());
+    x.assign(n, 0.0);
+    depth.assign(n, 0);
+    if (n == 0)
+        return;
+
+    std::vector<double> off(n, 0.0);
+    std::vector<Contour> contour(n);
+    for (int i = n - 1; i >= 0; --i)
+    {
+        int l = t.lchild[i], r = t.rchild[i];
+        Contour &c = contour[i];
+        if (l >= 0 && r >= 0)
+        {
+            mergeContour(contour[l], contour[r], off[l], off[r], c);
+        }
+        else if (l >= 0 || r >= 0)
+        {
+            int only = (l >= 0) ? l : r;
+            off[only] = (l >= 0) ? -MIN_SEP / 2 : MIN_SEP / 2;
+            c.lo.swap(contour[only].lo);
+            c.hi.swap(contour[only].hi);
+            c.shift = contour[only].shift + off[only];
+        }
+        c.lo.push_back(-c.shift);
+        c.hi.push_back(-c.shift);
+    }
+
+    double minX = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        minX = std::min(minX, x[i]);
+        if (t.lchild[i] >= 0)
+        {
+            x[t.lchild[i]] = x[i] + off[t.lchild[i]];
+            depth[t.lchild[i]] = depth[i] + 1;
+        }
+        if (t.rchild[i] >= 0)
+        {
+            x[t.rchild[i]] = x[i] + off[t.rchild[i]];
+            depth[t.rchild[i]] = depth[i] + 1;
+        }
+    }
+    for (int i = 0; i < n; ++i)
+        x[i] -= minX;
+}
+
+/**
+ * 追加结点标签，转义XML特殊字符
+ * @param out 输出缓冲区
+ * @param c 标签字符
+ */
+static void appendLabel(std::string &out, char c)
+{
+    switch (c)
+    {
+    case '<':
+        out += "&lt;";
+        break;
+    case '>':
+        out += "&gt;";
+        break;
+    case '&':
+        out += "&amp;";
+        break;
+    case '"':
+        out += "&quot;";
+        break;
+    default:
+        out += c;
+    }
+}
+
+/**
+ * 将二叉树渲染为SVG文本
+ * @param t 扁平化的二叉树
+ * @param out 输出缓冲区，SVG文本追加到末尾
+ *
+ * 算法实现:
+ * 1. 调用LayoutTree求各结点坐标。
+ * 2. 先输出所有边（左孩子蓝色、右孩子红色，与DOT输出一致），再输出结点圆和标签，保证结点覆盖在边之上。
+ * 3. 所有内容用snprintf格式化后直接追加到预留好容量的缓冲区，不经过文件流。
+ */
+void RenderTreeSvg(const SvgTree &t, std::string &out)
+{
+    std::vector<double> x;
+    std::vector<int> depth;
+    LayoutTree(t, x, depth);
+    int n = static_cast<int>(t.label.size());
+
+    double maxX = 0;
+    int maxDepth = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        maxX = std::max(maxX, x[i]);
+        maxDepth = std::max(maxDepth, depth[i]);
+    }
+    double width = maxX * UNIT + 2 * MARGIN;
+    double height = maxDepth * LEVEL_GAP + 2 * MARGIN;
+
+    char buf[256];
+    out.reserve(out.size() + 256 + static_cast<size_t>(n) * 192);
+    snprintf(buf, sizeof(buf),
+             "<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"%.0f\" height=\"%.0f\" viewBox=\"0 0 %.0f %.0f\">\n",
+             width, height, width, height);
+    out += buf;
+    if (n > 0)
+        out += "<g stroke-width=\"1.5\">\n";
+    for (int i = 0; i < n; ++i)
+    {
+        const int child[2] = {t.lchild[i], t.rchild[i]};
+        const char *color[2] = {"blue", "red"};
+        for (int k = 0; k < 2; ++k)
+        {
+            if (child[k] < 0)
+                continue;
+            snprintf(buf, sizeof(buf), "<line x1=\"%.1f\" y1=\"%.1f\" x2=\"%.1f\" y2=\"%.1f\" stroke=\"%s\"/>\n",
+                     MARGIN + x[i] * UNIT, MARGIN + depth[i] * LEVEL_GAP,
+                     MARGIN + x[child[k]] * UNIT, MARGIN + depth[child[k]] * LEVEL_GAP, color[k]);
+            out += buf;
+        }
+    }
+    if (n > 0)
+        out += "</g>\n<g font-family=\"monospace\" font-size=\"14\" text-anchor=\"middle\" dominant-baseline=\"central\">\n";
+    for (int i = 0; i < n; ++i)
+    {
+        double cx = MARGIN + x[i] * UNIT, cy = MARGIN + depth[i] * LEVEL_GAP;
+        snprintf(buf, sizeof(buf),
+                 "<circle cx=\"%.1f\" cy=\"%.1f\" r=\"%.0f\" fill=\"white\" stroke=\"black\"/><text x=\"%.1f\" y=\"%.1f\">",
+                 cx, cy, RADIUS, cx, cy);
+        out += buf;
+        appendLabel(out, t.label[i]);
+        out += "</text>\n";
+    }
+    if (n > 0)
+        out += "</g>\n";
+    out += "</svg>\n";
+}
@@ -0,0 +1,57 @@
+#ifndef ADAPTIVE_HUFFMAN_H
+#define ADAPTIVE_HUFFMAN_H
+
+#include "huffman_tree.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+#define AH_SYMBOLS 257                      // 256个字节 + 结束符
+#define AH_EOF 256                          // 结束符
+#define AH_NYT (-2)                         // NYT（尚未出现的符号）结点的符号标记
+#define AH_INTERNAL (-1)                    // 内部结点的符号标记
+#define AH_NODES (2 * (AH_SYMBOLS + 1) - 1) // 所有符号都出现后（含NYT）的结点数
+#define AH_RAW_BITS 9                       // 新符号跟在NYT编码后原样输出的位数
+#define AH_DEFAULT_LIMIT (1 << 16)          // 默认的根权重上限，达到后缩放
+
+// 自适应赫夫曼树（FGK）
+// 结点下标即结点编号：权重随下标非递减，兄弟结点下标相邻，根结点下标为AH_NODES-1，
+// NYT总是下标最小的结点，新结点在其下方分配
+typedef struct
+{
+    HTNode node[AH_NODES];
+    int sym[AH_NODES];    // 叶子对应的符号，内部结点为AH_INTERNAL，NYT为AH_NYT
+    int leaf[AH_SYMBOLS]; // 符号所在结点的下标，未出现为-1
+    int nyt;              // NYT结点的下标
+    HTWeight limit;       // 根权重达到该值时缩放全部权重
+} AHTree;
+
+// 流式编码器：不足一个字节的位跨调用保留
+typedef struct
+{
+    AHTree tree;
+    uint32_t acc; // 尚未输出的位，右对齐
+    int bits;     // acc中的有效位数
+} AHEncoder;
+
+// 流式解码器：可以在任意位处暂停，下次输入到来时继续
+typedef struct
+{
+    AHTree tree;
+    int cur;     // 从根向下走到的结点
+    int rawLeft; // 正在读取新符号时剩余的位数，0表示在树上行走
+    int raw;     // 已读取的新符号位
+    bool done;   // 已解出结束符
+} AHDecoder;
+
+void AHInit(AHTree &T, HTWeight limit = AH_DEFAULT_LIMIT);
+void AHUpdate(AHTree &T, int s);
+void AHRescale(AHTree &T);
+
+void AHEncoderInit(AHEncoder &E, HTWeight limit = AH_DEFAULT_LIMIT);
+void AHEncode(AHEncoder &E, const uint8_t *in, size_t n, std::vector<uint8_t> &out);
+void AHEncodeFinish(AHEncoder &E, std::vector<uint8_t> &out);
+void AHDecoderInit(AHDecoder &D, HTWeight limit = AH_DEFAULT_LIMIT);
+bool AHDecode(AHDecoder &D, const uint8_t *in, size_t n, std::vector<uint8_t> &out);
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef HUFFMAN_CODEC_H
+#define HUFFMAN_CODEC_H
+
+#include "huffman_tree.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#define HUF_SYMBOLS 256      // 字节符号数
+#define HUF_MAX_CODE_LEN 15  // 编码长度上限，由package-merge保证
+#define HUF_LUT_BITS 11      // 解码查找表的位数
+#define HUF_HEADER_SIZE (4 + 8 + HUF_SYMBOLS) // 魔数 + 原始长度 + 各符号编码长度
+#define HUF_BLOCK_SIZE (1 << 20)  // 分块压缩的默认块大小
+#define HUFP_FIXED_SIZE (4 + 8 + 4 + 8 + 1) // 分块格式固定头部：魔数 + 原始长度 + 块大小 + 块数 + 编码表方式
+
+// 分块压缩的编码表方式
+typedef enum
+{
+    HUF_SHARED_TABLE, // 所有块共用一张按全部数据统计的编码表
+    HUF_BLOCK_TABLES  // 每块按自身频数单独建表，表随块存储
+} HufTableMode;
+
+// 编码表：每个符号的规范编码及其长度
+typedef struct
+{
+    uint32_t code[HUF_SYMBOLS];
+    uint8_t len[HUF_SYMBOLS];
+} HufEncTable;
+
+// 查找表项：一次查表最多解出两个符号
+typedef struct
+{
+    uint8_t sym0, sym1; // 解出的符号
+    uint8_t bits0;      // 第一个符号的编码长度，0表示编码长于HUF_LUT_BITS，需走慢速路径
+    uint8_t bits;       // 两个符号的总长度，等于bits0时只解出一个符号
+} HufLutEntry;
+
+// 解码表：查找表加规范编码的逐长度首码表
+typedef struct
+{
+    HufLutEntry lut[1 << HUF_LUT_BITS];
+    uint64_t first[HUF_MAX_CODE_LEN + 1]; // 各长度的第一个规范编码
+    uint32_t count[HUF_MAX_CODE_LEN + 1]; // 各长度的符号数
+    uint32_t index[HUF_MAX_CODE_LEN + 1]; // 各长度第一个符号在sorted中的位置
+    uint8_t sorted[HUF_SYMBOLS];          // 按(长度, 符号)排序的符号
+    int maxLen;
+} HufDecTable;
+
+// 位写入器：按高位在前的顺序把编码拼接成64位字
+typedef struct
+{
+    uint64_t acc; // 尚未写出的位，右对齐
+    int bits;     // acc中的有效位数
+} HufBitWriter;
+
+// 位读取器：buf左对齐，最高位为下一个待读的位
+typedef struct
+{
+    uint64_t buf;
+    int cnt;
+    const uint8_t *p, *end;
+} HufBitReader;
+
+void HufCountFreq(const uint8_t *data, size_t n, uint64_t freq[HUF_SYMBOLS]);
+void HufBuildLengths(const uint64_t freq[HUF_SYMBOLS], uint8_t len[HUF_SYMBOLS]);
+void HufBuildEncTable(const uint8_t len[HUF_SYMBOLS], HufEncTable &t);
+bool HufBuildDecTable(const uint8_t len[HUF_SYMBOLS], HufDecTable &t);
+
+size_t HufEncodeBound(const HufEncTable &t, size_t n);
+size_t HufEncodeBlock(const HufEncTable &t, HufBitWriter &w, const uint8_t *in, size_t n, uint8_t *out);
+size_t HufFlushBits(HufBitWriter &w, uint8_t *out);
+void HufInitReader(HufBitReader &r, const uint8_t *in, size_t n);
+size_t HufDecodeBlock(const HufDecTable &t, HufBitReader &r, uint8_t *out, size_t n, bool final);
+
+bool HuffmanCompress(const uint8_t *data, size_t n, std::vector<uint8_t> &out);
+bool HuffmanDecompress(const uint8_t *data, size_t n, std::vector<uint8_t> &out);
+bool HuffmanCompressFile(const std::string &inPath, const std::string &outPath);
+bool HuffmanDecompressFile(const std::string &inPath, const std::string &outPath);
+
+bool HuffmanCompressParallel(const uint8_t *data, size_t n, std::vector<uint8_t> &out, int threads = 0,
+                             HufTableMode mode = HUF_SHARED_TABLE, size_t blockSize = HUF_BLOCK_SIZE);
+bool HuffmanDecompressParallel(const uint8_t *data, size_t n, std::vector<uint8_t> &out, int threads = 0);
+bool HuffmanCompressFileParallel(const std::string &inPath, const std::string &outPath, int threads = 0,
+                                 HufTableMode mode = HUF_SHARED_TABLE, size_t blockSize = HUF_BLOCK_SIZE);
+bool HuffmanDecompressFileParallel(const std::string &inPath, const std::string &outPath, int threads = 0);
+
+#endif
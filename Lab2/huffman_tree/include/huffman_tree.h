@@ -5,10 +5,13 @@
 #include <iostream>
 using namespace std;
 
+// 权重类型，使用64位避免真实频数累加溢出
+typedef long long HTWeight;
+
 // 赫夫曼树结点结构
 typedef struct
 {
-    int weight; // 权重
+    HTWeight weight; // 权重
     int parent; // 父节点索引
     int lchild; // 左孩子索引
     int rchild; // 右孩子索引
@@ -17,9 +20,34 @@ typedef struct
 // 动态分配字符串数组存储赫夫曼编码表
 typedef char **HTCode;
 
+// 规范赫夫曼编码：编码的低len位有效，高位在前
+typedef struct
+{
+    unsigned int code; // 编码
+    int len;           // 编码长度，0表示该符号不参与编码
+} HTCodeWord;
+
+// 规范编码表
+typedef HTCodeWord *HTCanonCode;
+
+// 赫夫曼树构造方式
+typedef enum
+{
+    HT_SELECT,    // 每次线性扫描选择两个最小结点，O(n²)
+    HT_HEAP2,     // 二叉最小堆，O(n log n)
+    HT_HEAP4,     // 四叉最小堆，O(n log n)
+    HT_TWO_QUEUE  // 双队列，要求叶子权重非递减，O(n)
+} HTBuildMode;
+
 // 函数声明
 void InitHTree(HTree &HT, int *w, int n);
-void CreateHTree(HTree &HT, int n);
+void InitHTree(HTree &HT, const HTWeight *w, int n);
+void CreateHTree(HTree &HT, int n, HTBuildMode mode = HT_SELECT);
+void CreateHTreeHeap(HTree &HT, int n, int arity);
+void CreateHTreeTwoQueue(HTree &HT, int n);
 void HTCoding(HTree HT, HTCode &HC, int n);
+void HTCodeLengths(HTree HT, int n, int *len);
+bool HTLimitedLengths(const HTWeight *w, int n, int maxLen, int *len);
+bool HTCanonicalCoding(const int *len, int n, HTCanonCode &HCC);
 
 #endif
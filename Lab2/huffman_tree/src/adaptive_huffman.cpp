@@ -0,0 +1,335 @@
+#include "adaptive_huffman.h"
+#include <algorithm>
+
+#define AH_ROOT (AH_NODES - 1)
+
+/**
+ * 初始化自适应赫夫曼树，初始时只有一个NYT结点作为根
+ * @param T 自适应赫夫曼树
+ * @param limit 根权重上限
+ */
+void AHInit(AHTree &T, HTWeight limit)
+{
+    for (int i = 0; i < AH_NODES; i++)
+    {
+        T.node[i].weight = 0;
+        T.node[i].parent = -1;
+        T.node[i].lchild = -1;
+        T.node[i].rchild = -1;
+        T.sym[i] = AH_INTERNAL;
+    }
+    for (int s = 0; s < AH_SYMBOLS; s++)
+        T.leaf[s] = -1;
+    T.nyt = AH_ROOT;
+    T.sym[AH_ROOT] = AH_NYT;
+    T.limit = std::max<HTWeight>(limit, 2);
+}
+
+// 结点内容移到新位置后，修正孩子的双亲指针和符号索引
+static void fixLinks(AHTree &T, int p)
+{
+    if (T.sym[p] == AH_INTERNAL)
+    {
+        T.node[T.node[p].lchild].parent = p;
+        T.node[T.node[p].rchild].parent = p;
+    }
+    else if (T.sym[p] == AH_NYT)
+        T.nyt = p;
+    else
+        T.leaf[T.sym[p]] = p;
+}
+
+/**
+ * 交换两个位置上的子树，双亲指针留在原位置
+ * @param T 自适应赫夫曼树
+ * @param a 位置
+ * @param b 位置
+ */
+static void swapNodes(AHTree &T, int a, int b)
+{
+    std::swap(T.node[a].weight, T.node[b].weight);
+    std::swap(T.node[a].lchild, T.node[b].lchild);
+    std::swap(T.node[a].rchild, T.node[b].rchild);
+    std::swap(T.sym[a], T.sym[b]);
+    fixLinks(T, a);
+    fixLinks(T, b);
+}
+
+/**
+ * 出现一次符号s后更新树（FGK算法）
+ * @param T 自适应赫夫曼树
+ * @param s 符号
+ *
+ * 算法实现:
+ * 1. s首次出现时分裂NYT：原NYT变为内部结点，左孩子为新NYT，右孩子为s的叶子。
+ * 2. 从s的叶子向上：先与同权重块中编号最大的结点（块首）交换，再把权重加1。
+ * 3. 只有兄弟为NYT时双亲才会与q同权重；若双亲是块首，先把q换到双亲下方的位置，此时q已不在双亲子树中，再与双亲交换。
+ * 4. 同权重的结点编号连续，从当前位置向上扫描即可找到块首。
+ * 5. 根权重达到上限时调用AHRescale。
+ */
+void AHUpdate(AHTree &T, int s)
+{
+    int q = T.leaf[s];
+    if (q == -1)
+    {
+        int old = T.nyt;
+        T.sym[old] = AH_INTERNAL;
+        T.node[old].lchild = old - 2;
+        T.node[old].rchild = old - 1;
+        T.node[old - 1].weight = 0;
+        T.node[old - 1].parent = old;
+        T.node[old - 1].lchild = T.node[old - 1].rchild = -1;
+        T.sym[old - 1] = s;
+        T.leaf[s] = old - 1;
+        T.node[old - 2].weight = 0;
+        T.node[old - 2].parent = old;
+        T.node[old - 2].lchild = T.node[old - 2].rchild = -1;
+        T.sym[old - 2] = AH_NYT;
+        T.nyt = old - 2;
+        q = old - 1;
+    }
+    while (q != -1)
+    {
+        int leader = q;
+        while (leader < AH_ROOT && T.node[leader + 1].weight == T.node[q].weight)
+            leader++;
+        if (leader == T.node[q].parent)
+        {
+            // q的兄弟是NYT，双亲与q同权重且为块首：先把q换到双亲下方的位置，离开双亲后再换到块首
+            if (leader - 1 != q)
+            {
+                swapNodes(T, q, leader - 1);
+                swapNodes(T, leader - 1, leader);
+                q = leader;
+            }
+        }
+        else if (leader != q)
+        {
+            swapNodes(T, q, leader);
+            q = leader;
+        }
+        T.node[q].weight++;
+        q = T.node[q].parent;
+    }
+    if (T.node[AH_ROOT].weight >= T.limit)
+        AHRescale(T);
+}
+
+/**
+ * 把所有叶子权重减半（已出现的符号至少保留1）并重建树
+ * @param T 自适应赫夫曼树
+ *
+ * 算法实现:
+ * 1. 叶子（含权重为0的NYT）按新权重排序后调用InitHTree和CreateHTree(HT_TWO_QUEUE)。
+ * 2. 双队列法依次取出的结点权重非递减，且每次取出的两个结点是兄弟。
+ * 3. 按取出顺序从低到高分配编号，根结点编号最大，即满足兄弟性质；NYT最先取出，编号最小。
+ */
+void AHRescale(AHTree &T)
+{
+    HTWeight w[AH_SYMBOLS + 1];
+    int order[AH_SYMBOLS + 1], sym[AH_SYMBOLS + 1];
+    int n = 0;
+    for (int i = 0; i < AH_NODES; i++)
+    {
+        if (T.sym[i] != AH_INTERNAL && (T.sym[i] == AH_NYT || T.leaf[T.sym[i]] == i))
+        {
+            sym[n] = T.sym[i];
+            w[n] = T.sym[i] == AH_NYT ? 0 : (T.node[i].weight + 1) / 2;
+            order[n] = n;
+            n++;
+        }
+    }
+    if (n < 2)
+        return;
+    std::stable_sort(order, order + n, [&w](int a, int b)
+                     { return w[a] < w[b]; });
+    HTWeight sorted[AH_SYMBOLS + 1];
+    for (int j = 0; j < n; j++)
+        sorted[j] = w[order[j]];
+
+    HTree HT;
+    InitHTree(HT, sorted, n);
+    CreateHTree(HT, n, HT_TWO_QUEUE);
+
+    int m = 2 * n - 1, base = AH_NODES - m, k = 0;
+    int pos[AH_NODES];
+    for (int i = n; i < m; i++)
+    {
+        pos[HT[i].lchild] = base + k++;
+        pos[HT[i].rchild] = base + k++;
+    }
+    pos[m - 1] = AH_ROOT;
+
+    HTWeight limit = T.limit;
+    AHInit(T, limit);
+    T.sym[AH_ROOT] = AH_INTERNAL;
+    for (int j = 0; j < m; j++)
+    {
+        int p = pos[j];
+        T.node[p].weight = HT[j].weight;
+        T.node[p].parent = HT[j].parent == -1 ? -1 : pos[HT[j].parent];
+        if (j < n)
+        {
+            T.sym[p] = sym[order[j]];
+            fixLinks(T, p);
+        }
+        else
+        {
+            T.node[p].lchild = pos[HT[j].lchild];
+            T.node[p].rchild = pos[HT[j].rchild];
+        }
+    }
+    delete[] HT;
+}
+
+/**
+ * 初始化流式编码器
+ * @param E 编码器
+ * @param limit 根权重上限，解码器须使用相同的值
+ */
+void AHEncoderInit(AHEncoder &E, HTWeight limit)
+{
+    AHInit(E.tree, limit);
+    E.acc = 0;
+    E.bits = 0;
+}
+
+// 输出len位（右对齐），凑满一个字节即写出
+static inline void putBits(AHEncoder &E, uint32_t v, int len, std::vector<uint8_t> &out)
+{
+    for (int i = len - 1; i >= 0; i--)
+    {
+        E.acc = (E.acc << 1) | ((v >> i) & 1);
+        if (++E.bits == 8)
+        {
+            out.push_back(static_cast<uint8_t>(E.acc));
+            E.acc = 0;
+            E.bits = 0;
+        }
+    }
+}
+
+/**
+ * 编码一个符号并更新树
+ * @param E 编码器
+ * @param s 符号
+ * @param out 输出
+ *
+ * 算法实现:
+ * 1. s已出现时输出其叶子的路径；否则输出NYT的路径，再原样输出AH_RAW_BITS位的s。
+ * 2. 从叶子向上追溯双亲得到逆序的路径，再按从根到叶子的顺序输出。
+ */
+static void encodeSymbol(AHEncoder &E, int s, std::vector<uint8_t> &out)
+{
+    AHTree &T = E.tree;
+    int q = T.leaf[s] != -1 ? T.leaf[s] : T.nyt;
+    char path[AH_NODES];
+    int len = 0;
+    for (int p = T.node[q].parent; p != -1; q = p, p = T.node[p].parent)
+        path[len++] = (T.node[p].rchild == q);
+    while (len > 0)
+        putBits(E, static_cast<uint32_t>(path[--len]), 1, out);
+    if (T.leaf[s] == -1)
+        putBits(E, static_cast<uint32_t>(s), AH_RAW_BITS, out);
+    AHUpdate(T, s);
+}
+
+/**
+ * 流式编码一段数据，只需一遍扫描，可以多次调用
+ * @param E 编码器
+ * @param in 输入数据
+ * @param n 输入长度
+ * @param out 追加写出完整的字节，不足一个字节的位留在编码器中
+ */
+void AHEncode(AHEncoder &E, const uint8_t *in, size_t n, std::vector<uint8_t> &out)
+{
+    for (size_t i = 0; i < n; i++)
+        encodeSymbol(E, in[i], out);
+}
+
+/**
+ * 结束编码：输出结束符，最后一个字节低位补0
+ * @param E 编码器
+ * @param out 输出
+ */
+void AHEncodeFinish(AHEncoder &E, std::vector<uint8_t> &out)
+{
+    encodeSymbol(E, AH_EOF, out);
+    if (E.bits > 0)
+        putBits(E, 0, 8 - E.bits, out);
+}
+
+// 解码器回到根结点；树中只有NYT时直接开始读取新符号
+static inline void resetWalk(AHDecoder &D)
+{
+    D.cur = AH_ROOT;
+    D.raw = 0;
+    D.rawLeft = (D.tree.sym[AH_ROOT] == AH_NYT) ? AH_RAW_BITS : 0;
+}
+
+/**
+ * 初始化流式解码器
+ * @param D 解码器
+ * @param limit 根权重上限，须与编码器相同
+ */
+void AHDecoderInit(AHDecoder &D, HTWeight limit)
+{
+    AHInit(D.tree, limit);
+    D.done = false;
+    resetWalk(D);
+}
+
+/**
+ * 流式解码一段数据，可以在任意位处暂停，下次调用时继续
+ * @param D 解码器
+ * @param in 输入数据
+ * @param n 输入长度
+ * @param out 追加写出解出的字节
+ * @return 数据损坏（新符号超出范围或重复出现）时返回false
+ *
+ * 算法实现:
+ * 1. 按位从根向下行走，到达字节叶子时输出并更新树，回到根。
+ * 2. 到达NYT时再读AH_RAW_BITS位得到新符号，同样输出并更新树。
+ * 3. 解出结束符后置done，忽略之后的补齐位。
+ */
+bool AHDecode(AHDecoder &D, const uint8_t *in, size_t n, std::vector<uint8_t> &out)
+{
+    AHTree &T = D.tree;
+    for (size_t i = 0; i < n && !D.done; i++)
+    {
+        for (int b = 7; b >= 0 && !D.done; b--)
+        {
+            int bit = (in[i] >> b) & 1;
+            int s;
+            if (D.rawLeft > 0)
+            {
+                D.raw = (D.raw << 1) | bit;
+                if (--D.rawLeft > 0)
+                    continue;
+                s = D.raw;
+                if (s >= AH_SYMBOLS || T.leaf[s] != -1)
+                    return false;
+            }
+            else
+            {
+                D.cur = bit ? T.node[D.cur].rchild : T.node[D.cur].lchild;
+                if (T.sym[D.cur] == AH_INTERNAL)
+                    continue;
+                if (T.sym[D.cur] == AH_NYT)
+                {
+                    D.rawLeft = AH_RAW_BITS;
+                    D.raw = 0;
+                    continue;
+                }
+                s = T.sym[D.cur];
+            }
+            AHUpdate(T, s);
+            if (s == AH_EOF)
+                D.done = true;
+            else
+                out.push_back(static_cast<uint8_t>(s));
+            resetWalk(D);
+        }
+    }
+    return true;
+}
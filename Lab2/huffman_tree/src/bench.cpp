@@ -0,0 +1,322 @@
+#include "huffman_tree.h"
+#include "huffman_codec.h"
+#include "adaptive_huffman.h"
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+// 固定种子的xorshift64*生成器，语料在任何平台上都逐字节相同
+struct BenchRng
+{
+    uint64_t s;
+    explicit BenchRng(uint64_t seed) : s(seed) {}
+    uint64_t next()
+    {
+        s ^= s >> 12;
+        s ^= s << 25;
+        s ^= s >> 27;
+        return s * 0x2545F4914F6CDD1DULL;
+    }
+};
+
+/**
+ * 生成类文本语料：按近似Zipf分布选词，夹杂标点和换行
+ * @param n 字节数
+ * @param out 语料
+ */
+static void genText(size_t n, std::vector<uint8_t> &out)
+{
+    static const char *words[] = {"the", "of", "and", "to", "a", "in", "is", "that", "for", "it",
+                                  "as", "with", "was", "on", "be", "by", "tree", "node", "weight", "code",
+                                  "huffman", "binary", "parent", "child", "length", "symbol", "stream", "table",
+                                  "encode", "decode", "frequency", "canonical"};
+    const int W = sizeof(words) / sizeof(words[0]);
+    BenchRng rng(1);
+    out.clear();
+    out.reserve(n + 16);
+    while (out.size() < n)
+    {
+        // 取两个均匀数的最小值，使小下标的词出现得更频繁
+        int a = static_cast<int>(rng.next() % W), b = static_cast<int>(rng.next() % W);
+        for (const char *p = words[std::min(a, b)]; *p; p++)
+            out.push_back(static_cast<uint8_t>(*p));
+        uint64_t r = rng.next() % 100;
+        out.push_back(r < 5 ? ',' : r < 8 ? '.' : r < 9 ? '\n' : ' ');
+    }
+    out.resize(n);
+}
+
+// 偏斜语料：字节值服从几何分布，0最多
+static void genSkewed(size_t n, std::vector<uint8_t> &out)
+{
+    BenchRng rng(2);
+    out.resize(n);
+    for (size_t i = 0; i < n; i++)
+    {
+        uint64_t r = rng.next() | (1ULL << 63);
+        out[i] = static_cast<uint8_t>(__builtin_ctzll(r) * 3 + (r >> 62 & 1));
+    }
+}
+
+// 均匀语料：每个字节独立均匀分布，几乎不可压缩
+static void genUniform(size_t n, std::vector<uint8_t> &out)
+{
+    BenchRng rng(3);
+    out.resize(n);
+    for (size_t i = 0; i < n; i++)
+        out[i] = static_cast<uint8_t>(rng.next() >> 56);
+}
+
+// 二进制语料：小端32位整数记录，数值为小幅随机游走，高位字节大多为0
+static void genBinary(size_t n, std::vector<uint8_t> &out)
+{
+    BenchRng rng(4);
+    out.resize(n);
+    int32_t v = 0;
+    for (size_t i = 0; i < n; i += 4)
+    {
+        v += static_cast<int32_t>(rng.next() % 201) - 100;
+        for (size_t k = 0; k < 4 && i + k < n; k++)
+            out[i + k] = static_cast<uint8_t>(static_cast<uint32_t>(v) >> (8 * k));
+    }
+}
+
+template <class F>
+static double timeIt(F f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// 当前的常驻内存，单位KB
+static long currentRssKb()
+{
+    long pages = 0, resident = 0;
+    FILE *f = fopen("/proc/self/statm", "r");
+    if (f)
+    {
+        if (fscanf(f, "%ld %ld", &pages, &resident) != 2)
+            resident = 0;
+        fclose(f);
+    }
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+/**
+ * 在子进程中运行一项测量，求这一项自身使用的峰值常驻内存
+ * @param f 测量函数，返回值经管道传回，须可按字节复制
+ * @param result f的返回值
+ * @param peakKb 子进程的峰值常驻内存减去fork时继承的常驻内存，单位KB
+ * @return 子进程正常结束并传回结果时返回true
+ *
+ * 算法实现:
+ * 1. getrusage(RUSAGE_SELF)是整个进程至今的峰值，先测的项会抬高后测各项的读数；每项放在新fork的子进程中运行。
+ * 2. 子进程先记下继承来的常驻内存（语料等），与结果一起传回；父进程用wait4取该子进程的ru_maxrss，减去这部分。
+ */
+template <class T, class F>
+static bool runIsolated(F f, T &result, long &peakKb)
+{
+    int fd[2];
+    if (pipe(fd) != 0)
+        return false;
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        close(fd[0]);
+        close(fd[1]);
+        return false;
+    }
+    if (pid == 0)
+    {
+        close(fd[0]);
+        long base = currentRssKb();
+        T r = f();
+        bool sent = write(fd[1], &base, sizeof(base)) == static_cast<ssize_t>(sizeof(base)) &&
+                    write(fd[1], &r, sizeof(r)) == static_cast<ssize_t>(sizeof(r));
+        _exit(sent ? 0 : 1);
+    }
+    close(fd[1]);
+    long base = 0;
+    bool got = read(fd[0], &base, sizeof(base)) == static_cast<ssize_t>(sizeof(base)) &&
+               read(fd[0], &result, sizeof(result)) == static_cast<ssize_t>(sizeof(result));
+    close(fd[0]);
+    int status = 0;
+    struct rusage ru;
+    if (wait4(pid, &status, 0, &ru) != pid)
+        return false;
+    peakKb = std::max(0L, ru.ru_maxrss - base);
+    return got && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+/**
+ * 测量一种构造方式建树的时间
+ * @param w 叶子权重，已按非递减排序
+ * @param mode 构造方式
+ * @param reps 重复次数
+ * @return 每次建树的平均毫秒数
+ */
+static double timeBuild(const std::vector<HTWeight> &w, HTBuildMode mode, int reps)
+{
+    double t = 0;
+    for (int r = 0; r < reps; r++)
+    {
+        HTree HT;
+        InitHTree(HT, w.data(), static_cast<int>(w.size()));
+        t += timeIt([&]()
+                    { CreateHTree(HT, static_cast<int>(w.size()), mode); });
+        delete[] HT;
+    }
+    return t / reps;
+}
+
+/**
+ * 对一份语料输出建树和编解码的测量结果，每项一行JSON
+ * @param name 语料名
+ * @param data 语料
+ * @param rounds 编解码重复次数，取最快一次
+ * @param threads 分块并行使用的线程数
+ */
+static bool benchCorpus(const char *name, const std::vector<uint8_t> &data, int rounds, int threads)
+{
+    static const HTBuildMode modes[] = {HT_SELECT, HT_HEAP2, HT_HEAP4, HT_TWO_QUEUE};
+    static const char *modeNames[] = {"select", "heap2", "heap4", "two_queue"};
+
+    // 建树：字节字母表（256）和相邻字节对字母表（65536）各测一次
+    std::vector<uint64_t> pairs(1 << 16, 0);
+    for (size_t i = 0; i + 1 < data.size(); i += 2)
+        pairs[data[i] << 8 | data[i + 1]]++;
+    uint64_t bytes[HUF_SYMBOLS] = {0};
+    HufCountFreq(data.data(), data.size(), bytes);
+    for (int alphabet : {256, 65536})
+    {
+        std::vector<HTWeight> w;
+        for (int s = 0; s < alphabet; s++)
+        {
+            uint64_t f = alphabet == 256 ? bytes[s] : pairs[s];
+            if (f)
+                w.push_back(static_cast<HTWeight>(f));
+        }
+        std::sort(w.begin(), w.end());
+        if (w.size() < 2)
+            continue;
+        for (int m = 0; m < 4; m++)
+        {
+            // 选择法为O(n²)，叶子过多时跳过
+            if (modes[m] == HT_SELECT && w.size() > 4096)
+                continue;
+            int reps = std::max(1, static_cast<int>(200000 / w.size()));
+            double ms = 0;
+            long peak = 0;
+            if (!runIsolated([&]()
+                             { return timeBuild(w, modes[m], reps); }, ms, peak))
+                return false;
+            printf("{\"corpus\":\"%s\",\"bench\":\"build\",\"mode\":\"%s\",\"alphabet\":%d,\"leaves\":%zu,"
+                   "\"us_per_build\":%.3f,\"peak_rss_kb\":%ld}\n",
+                   name, modeNames[m], alphabet, w.size(), ms * 1000, peak);
+        }
+    }
+
+    // 编解码：单流格式、分块共用表、分块独立表、自适应
+    static const char *codecNames[] = {"huf1", "hufp_shared", "hufp_block", "adaptive"};
+    double mb = data.size() / 1e6;
+    for (int c = 0; c < 4; c++)
+    {
+        struct
+        {
+            double enc, dec;
+            size_t compressed;
+            bool ok;
+        } res = {0, 0, 0, false};
+        long peak = 0;
+        auto measure = [&]()
+        {
+            std::vector<uint8_t> packed, unpacked;
+            double enc = 1e300, dec = 1e300;
+            bool ok = true;
+            for (int r = 0; r < rounds; r++)
+            {
+                enc = std::min(enc, timeIt([&]()
+                                           {
+                    if (c == 0)
+                        HuffmanCompress(data.data(), data.size(), packed);
+                    else if (c == 3)
+                    {
+                        AHEncoder E;
+                        AHEncoderInit(E);
+                        packed.clear();
+                        AHEncode(E, data.data(), data.size(), packed);
+                        AHEncodeFinish(E, packed);
+                    }
+                    else
+                        HuffmanCompressParallel(data.data(), data.size(), packed, threads,
+                                                c == 1 ? HUF_SHARED_TABLE : HUF_BLOCK_TABLES); }));
+                dec = std::min(dec, timeIt([&]()
+                                           {
+                    if (c == 0)
+                        ok = HuffmanDecompress(packed.data(), packed.size(), unpacked) && ok;
+                    else if (c == 3)
+                    {
+                        AHDecoder D;
+                        AHDecoderInit(D);
+                        unpacked.clear();
+                        ok = AHDecode(D, packed.data(), packed.size(), unpacked) && D.done && ok;
+                    }
+                    else
+                        ok = HuffmanDecompressParallel(packed.data(), packed.size(), unpacked, threads) && ok; }));
+            }
+            decltype(res) out = {enc, dec, packed.size(), ok && unpacked == data};
+            return out;
+        };
+        if (!runIsolated(measure, res, peak))
+            res.ok = false;
+        printf("{\"corpus\":\"%s\",\"bench\":\"codec\",\"format\":\"%s\",\"threads\":%d,\"bytes\":%zu,"
+               "\"compressed\":%zu,\"ratio\":%.4f,\"encode_mb_s\":%.1f,\"decode_mb_s\":%.1f,\"ok\":%s,\"peak_rss_kb\":%ld}\n",
+               name, codecNames[c], (c == 0 || c == 3) ? 1 : threads, data.size(), res.compressed,
+               static_cast<double>(res.compressed) / data.size(), mb / (res.enc / 1000), mb / (res.dec / 1000),
+               res.ok ? "true" : "false", peak);
+        if (!res.ok)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * 赫夫曼基准测试，结果按行输出JSON，便于脚本逐次比较
+ * 用法: huf_bench [每份语料的MB数=16] [线程数=0] [轮数=3]
+ */
+int main(int argc, char *argv[])
+{
+    size_t n = static_cast<size_t>(argc > 1 ? std::atof(argv[1]) * (1 << 20) : 16 << 20);
+    int threads = argc > 2 ? std::atoi(argv[2]) : 0;
+    int rounds = argc > 3 ? std::max(1, std::atoi(argv[3])) : 3;
+    if (threads <= 0)
+        threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    struct
+    {
+        const char *name;
+        void (*gen)(size_t, std::vector<uint8_t> &);
+    } corpora[] = {{"text", genText}, {"skewed", genSkewed}, {"uniform", genUniform}, {"binary", genBinary}};
+
+    std::vector<uint8_t> data;
+    for (auto &c : corpora)
+    {
+        c.gen(n, data);
+        if (!benchCorpus(c.name, data, rounds, threads))
+        {
+            fprintf(stderr, "校验失败: %s\n", c.name);
+            return 1;
+        }
+    }
+    return 0;
+}
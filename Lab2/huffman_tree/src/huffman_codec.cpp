@@ -0,0 +1,1072 @@
+#include "huffman_codec.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+#include <fstream>
+#include <thread>
+
+static const uint8_t HUF_MAGIC[4] = {'H', 'U', 'F', '1'};
+static const size_t HUF_CHUNK = 1 << 22; // 文件流式处理时每次读入的字节数
+
+// 以大端序读写64位字，使位流与主机字节序无关
+static inline uint64_t LoadBE64(const uint8_t *p)
+{
+    uint64_t v;
+    memcpy(&v, p, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+}
+
+static inline void StoreBE64(uint8_t *p, uint64_t v)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    memcpy(p, &v, 8);
+}
+
+/**
+ * 统计字节频数（累加到freq中）
+ * @param data 输入数据
+ * @param n 输入长度
+ * @param freq 各字节的频数，调用前由调用者清零
+ *
+ * 算法实现:
+ * 1. 使用4组计数器轮流累加，避免相邻相同字节造成的读写依赖。
+ * 2. 最后把4组计数器合并到freq。
+ */
+void HufCountFreq(const uint8_t *data, size_t n, uint64_t freq[HUF_SYMBOLS])
+{
+    uint64_t c[4][HUF_SYMBOLS];
+    memset(c, 0, sizeof(c));
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        c[0][data[i]]++;
+        c[1][data[i + 1]]++;
+        c[2][data[i + 2]]++;
+        c[3][data[i + 3]]++;
+    }
+    for (; i < n; i++)
+        c[0][data[i]]++;
+    for (int s = 0; s < HUF_SYMBOLS; s++)
+        freq[s] += c[0][s] + c[1][s] + c[2][s] + c[3][s];
+}
+
+/**
+ * 由频数求各符号的编码长度
+ * @param freq 各字节的频数
+ * @param len 返回各符号的编码长度，未出现的符号为0
+ *
+ * 算法实现:
+ * 1. 只取出现过的符号作为叶子。
+ * 2. 调用HTLimitedLengths求长度不超过HUF_MAX_CODE_LEN的最优编码长度。
+ */
+void HufBuildLengths(const uint64_t freq[HUF_SYMBOLS], uint8_t len[HUF_SYMBOLS])
+{
+    int sym[HUF_SYMBOLS], l[HUF_SYMBOLS];
+    HTWeight w[HUF_SYMBOLS];
+    int k = 0;
+    for (int s = 0; s < HUF_SYMBOLS; s++)
+    {
+        len[s] = 0;
+        if (freq[s])
+        {
+            sym[k] = s;
+            w[k] = static_cast<HTWeight>(freq[s]);
+            k++;
+        }
+    }
+    HTLimitedLengths(w, k, HUF_MAX_CODE_LEN, l);
+    for (int j = 0; j < k; j++)
+        len[sym[j]] = static_cast<uint8_t>(l[j]);
+}
+
+/**
+ * 由编码长度构造编码表
+ * @param len 各符号的编码长度
+ * @param t 编码表
+ *
+ * 算法实现:
+ * 1. 调用HTCanonicalCoding生成规范编码，复制为定长数组以便编码时直接下标访问。
+ */
+void HufBuildEncTable(const uint8_t len[HUF_SYMBOLS], HufEncTable &t)
+{
+    int l[HUF_SYMBOLS];
+    for (int s = 0; s < HUF_SYMBOLS; s++)
+        l[s] = len[s];
+    HTCanonCode HCC;
+    HTCanonicalCoding(l, HUF_SYMBOLS, HCC);
+    for (int s = 0; s < HUF_SYMBOLS; s++)
+    {
+        t.code[s] = HCC[s].code;
+        t.len[s] = static_cast<uint8_t>(HCC[s].len);
+    }
+    delete[] HCC;
+}
+
+/**
+ * 在规范编码中匹配value的最短前缀
+ * @param t 解码表
+ * @param value 待匹配的位串（右对齐）
+ * @param width value的位数
+ * @param sym 返回匹配到的符号
+ * @param l 返回匹配到的编码长度
+ * @return 是否匹配成功
+ */
+static bool MatchPrefix(const HufDecTable &t, uint32_t value, int width, uint8_t &sym, int &l)
+{
+    int limit = std::min(width, t.maxLen);
+    for (int k = 1; k <= limit; k++)
+    {
+        uint64_t code = value >> (width - k);
+        if (code - t.first[k] < t.count[k])
+        {
+            sym = t.sorted[t.index[k] + (code - t.first[k])];
+            l = k;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * 由编码长度构造解码表
+ * @param len 各符号的编码长度
+ * @param t 解码表
+ * @return 长度合法（不超过上限且满足Kraft不等式）返回true
+ *
+ * 算法实现:
+ * 1. 检查长度上限和Kraft不等式，拒绝损坏的头部。
+ * 2. 按规范编码规则求每种长度的首码，并把符号按(长度, 符号)排序。
+ * 3. 对HUF_LUT_BITS位的每种取值，预先解出开头的一个符号，剩余位足够时再解出第二个符号，记录总共消耗的位数。
+ */
+bool HufBuildDecTable(const uint8_t len[HUF_SYMBOLS], HufDecTable &t)
+{
+    memset(t.count, 0, sizeof(t.count));
+    uint64_t kraft = 0;
+    t.maxLen = 0;
+    for (int s = 0; s < HUF_SYMBOLS; s++)
+    {
+        if (len[s] > HUF_MAX_CODE_LEN)
+            return false;
+        if (len[s])
+        {
+            t.count[len[s]]++;
+            kraft += 1ULL << (HUF_MAX_CODE_LEN - len[s]);
+            t.maxLen = std::max<int>(t.maxLen, len[s]);
+        }
+    }
+    if (kraft > (1ULL << HUF_MAX_CODE_LEN))
+        return false;
+
+    uint64_t code = 0;
+    uint32_t idx = 0;
+    t.first[0] = 0;
+    t.index[0] = 0;
+    for (int l = 1; l <= HUF_MAX_CODE_LEN; l++)
+    {
+        code = (code + t.count[l - 1]) << 1;
+        t.first[l] = code;
+        idx += t.count[l - 1];
+        t.index[l] = idx;
+    }
+    uint32_t fill[HUF_MAX_CODE_LEN + 1];
+    memcpy(fill, t.index, sizeof(fill));
+    for (int s = 0; s < HUF_SYMBOLS; s++)
+    {
+        if (len[s])
+            t.sorted[fill[len[s]]++] = static_cast<uint8_t>(s);
+    }
+
+    for (uint32_t v = 0; v < (1u << HUF_LUT_BITS); v++)
+    {
+        HufLutEntry &e = t.lut[v];
+        e.sym0 = e.sym1 = 0;
+        e.bits0 = e.bits = 0;
+        uint8_t s0, s1;
+        int l0, l1;
+        if (!MatchPrefix(t, v, HUF_LUT_BITS, s0, l0))
+            continue;
+        e.sym0 = s0;
+        e.bits0 = e.bits = static_cast<uint8_t>(l0);
+        int rest = HUF_LUT_BITS - l0;
+        if (rest > 0 && MatchPrefix(t, v & ((1u << rest) - 1), rest, s1, l1))
+        {
+            e.sym1 = s1;
+            e.bits = static_cast<uint8_t>(l0 + l1);
+        }
+    }
+    return true;
+}
+
+/**
+ * 编码n个字节所需输出缓冲区的上界
+ * @param t 编码表
+ * @param n 输入长度
+ * @return 字节数
+ */
+size_t HufEncodeBound(const HufEncTable &t, size_t n)
+{
+    int maxLen = 0;
+    for (int s = 0; s < HUF_SYMBOLS; s++)
+        maxLen = std::max<int>(maxLen, t.len[s]);
+    return (n * maxLen + 63) / 64 * 8 + 8;
+}
+
+/**
+ * 编码一段字节，完整的64位字直接写出，不足64位的部分留在位写入器中
+ * @param t 编码表
+ * @param w 位写入器，跨多次调用保持状态
+ * @param in 输入数据
+ * @param n 输入长度
+ * @param out 输出缓冲区，容量不小于HufEncodeBound(t, n)
+ * @return 写出的字节数
+ *
+ * 算法实现:
+ * 1. 编码按高位在前拼接到64位累加器中。
+ * 2. 累加器满64位时以大端序整字写出，剩余的低位留作下一个字的开头。
+ */
+size_t HufEncodeBlock(const HufEncTable &t, HufBitWriter &w, const uint8_t *in, size_t n, uint8_t *out)
+{
+    uint64_t acc = w.acc;
+    int bits = w.bits;
+    uint8_t *o = out;
+    for (size_t i = 0; i < n; i++)
+    {
+        uint32_t c = t.code[in[i]];
+        int l = t.len[in[i]];
+        if (bits + l < 64)
+        {
+            acc = (acc << l) | c;
+            bits += l;
+        }
+        else
+        {
+            int r = 64 - bits;
+            StoreBE64(o, (acc << r) | (static_cast<uint64_t>(c) >> (l - r)));
+            o += 8;
+            bits = l - r;
+            acc = c & ((1ULL << bits) - 1);
+        }
+    }
+    w.acc = acc;
+    w.bits = bits;
+    return static_cast<size_t>(o - out);
+}
+
+/**
+ * 写出位写入器中剩余的位，最后一个字节低位补0
+ * @param w 位写入器
+ * @param out 输出缓冲区，至少8字节
+ * @return 写出的字节数
+ */
+size_t HufFlushBits(HufBitWriter &w, uint8_t *out)
+{
+    size_t nbytes = (w.bits + 7) / 8;
+    if (w.bits > 0)
+    {
+        uint64_t v = w.acc << (64 - w.bits);
+        for (size_t i = 0; i < nbytes; i++)
+            out[i] = static_cast<uint8_t>(v >> (56 - 8 * i));
+    }
+    w.acc = 0;
+    w.bits = 0;
+    return nbytes;
+}
+
+/**
+ * 初始化位读取器
+ * @param r 位读取器
+ * @param in 输入数据
+ * @param n 输入长度
+ */
+void HufInitReader(HufBitReader &r, const uint8_t *in, size_t n)
+{
+    r.buf = 0;
+    r.cnt = 0;
+    r.p = in;
+    r.end = in + n;
+}
+
+// 补充位缓冲区：剩余输入不少于8字节时一次装入整字，否则逐字节装入
+static inline void Refill(HufBitReader &r)
+{
+    if (r.end - r.p >= 8)
+    {
+        r.buf |= LoadBE64(r.p) >> r.cnt;
+        int bytes = (63 - r.cnt) >> 3;
+        r.p += bytes;
+        r.cnt += bytes << 3;
+    }
+    else
+    {
+        while (r.cnt <= 56 && r.p < r.end)
+        {
+            r.buf |= static_cast<uint64_t>(*r.p++) << (56 - r.cnt);
+            r.cnt += 8;
+        }
+    }
+}
+
+// 解码一个符号，失败返回false
+static inline bool DecodeOne(const HufDecTable &t, HufBitReader &r, uint8_t &sym)
+{
+    const HufLutEntry &e = t.lut[r.buf >> (64 - HUF_LUT_BITS)];
+    if (e.bits0)
+    {
+        sym = e.sym0;
+        r.buf <<= e.bits0;
+        r.cnt -= e.bits0;
+        return true;
+    }
+    for (int l = HUF_LUT_BITS + 1; l <= t.maxLen; l++)
+    {
+        uint64_t code = r.buf >> (64 - l);
+        if (code - t.first[l] < t.count[l])
+        {
+            sym = t.sorted[t.index[l] + (code - t.first[l])];
+            r.buf <<= l;
+            r.cnt -= l;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * 解码最多n个符号
+ * @param t 解码表
+ * @param r 位读取器，跨多次调用保持状态
+ * @param out 输出缓冲区
+ * @param n 期望解出的符号数
+ * @param final 输入是否已全部给出；为false时剩余输入不足8字节即返回，等待调用者补充输入
+ * @return 实际解出的符号数，小于n且final为true表示数据损坏
+ *
+ * 算法实现:
+ * 1. 每次整字补充位缓冲区后至少有57位可用，足够连续查两次表。
+ * 2. 以缓冲区高HUF_LUT_BITS位查表，一次可解出两个符号；编码更长时按规范编码逐长度比较首码。
+ * 3. 输入结束后缓冲区低位为补齐的0，按符号数停止，不会多解。
+ */
+size_t HufDecodeBlock(const HufDecTable &t, HufBitReader &r, uint8_t *out, size_t n, bool final)
+{
+    size_t k = 0;
+    while (k + 4 <= n && r.end - r.p >= 8)
+    {
+        Refill(r);
+        for (int rep = 0; rep < 2; rep++)
+        {
+            const HufLutEntry &e = t.lut[r.buf >> (64 - HUF_LUT_BITS)];
+            if (e.bits0)
+            {
+                out[k] = e.sym0;
+                out[k + 1] = e.sym1;
+                k += (e.bits != e.bits0) ? 2 : 1;
+                r.buf <<= e.bits;
+                r.cnt -= e.bits;
+            }
+            else if (!DecodeOne(t, r, out[k++]))
+                return k - 1;
+        }
+    }
+    if (!final)
+        return k;
+    while (k < n)
+    {
+        Refill(r);
+        if (r.p == r.end)
+            r.cnt = 64;
+        if (!DecodeOne(t, r, out[k]))
+            break;
+        k++;
+    }
+    return k;
+}
+
+// 以小端序写入64位整数
+static void PutLE64(uint8_t *p, uint64_t v)
+{
+    for (int i = 0; i < 8; i++)
+        p[i] = static_cast<uint8_t>(v >> (8 * i));
+}
+
+static uint64_t GetLE64(const uint8_t *p)
+{
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++)
+        v |= static_cast<uint64_t>(p[i]) << (8 * i);
+    return v;
+}
+
+// 写出头部：魔数、原始长度、各符号编码长度
+static void WriteHeader(uint8_t *p, uint64_t size, const uint8_t len[HUF_SYMBOLS])
+{
+    memcpy(p, HUF_MAGIC, 4);
+    PutLE64(p + 4, size);
+    memcpy(p + 12, len, HUF_SYMBOLS);
+}
+
+/**
+ * 压缩内存中的数据
+ * @param data 输入数据
+ * @param n 输入长度
+ * @param out 压缩结果
+ * @return 是否成功
+ *
+ * 算法实现:
+ * 1. 统计频数，构造赫夫曼树求编码长度，再构造规范编码表。
+ * 2. 由频数和编码长度精确算出压缩后的位数，一次分配输出缓冲区。
+ * 3. 写出头部，按64位字打包写出编码。
+ */
+bool HuffmanCompress(const uint8_t *data, size_t n, std::vector<uint8_t> &out)
+{
+    uint64_t freq[HUF_SYMBOLS] = {0};
+    uint8_t len[HUF_SYMBOLS];
+    HufEncTable t;
+    HufCountFreq(data, n, freq);
+    HufBuildLengths(freq, len);
+    HufBuildEncTable(len, t);
+
+    uint64_t bits = 0;
+    for (int s = 0; s < HUF_SYMBOLS; s++)
+        bits += freq[s] * len[s];
+    out.resize(HUF_HEADER_SIZE + (bits + 7) / 8 + 8);
+    WriteHeader(out.data(), n, len);
+
+    HufBitWriter w = {0, 0};
+    size_t bytes = HufEncodeBlock(t, w, data, n, out.data() + HUF_HEADER_SIZE);
+    bytes += HufFlushBits(w, out.data() + HUF_HEADER_SIZE + bytes);
+    out.resize(HUF_HEADER_SIZE + bytes);
+    return true;
+}
+
+/**
+ * 解压内存中的数据
+ * @param data 压缩数据
+ * @param n 压缩数据长度
+ * @param out 解压结果
+ * @return 数据完整且格式正确返回true
+ *
+ * 算法实现:
+ * 1. 校验魔数，读出原始长度和各符号编码长度，构造解码表。
+ * 2. 每个符号至少占1位，原始长度超过数据部分位数的头部必然已损坏，在分配输出之前拒绝。
+ * 3. 调用HufDecodeBlock按原始长度解码。
+ */
+bool HuffmanDecompress(const uint8_t *data, size_t n, std::vector<uint8_t> &out)
+{
+    if (n < HUF_HEADER_SIZE || memcmp(data, HUF_MAGIC, 4) != 0)
+        return false;
+    uint64_t size = GetLE64(data + 4);
+    if (size > 8 * static_cast<uint64_t>(n - HUF_HEADER_SIZE))
+        return false;
+    HufDecTable t;
+    if (!HufBuildDecTable(data + 12, t))
+        return false;
+    if (size > 0 && t.maxLen == 0)
+        return false;
+    out.resize(size);
+    HufBitReader r;
+    HufInitReader(r, data + HUF_HEADER_SIZE, n - HUF_HEADER_SIZE);
+    return HufDecodeBlock(t, r, out.data(), size, true) == size;
+}
+
+/**
+ * 流式压缩文件
+ * @param inPath 输入文件路径
+ * @param outPath 输出文件路径
+ * @return 是否成功
+ *
+ * 算法实现:
+ * 1. 第一遍按块读入文件统计频数，构造编码表并写出头部。
+ * 2. 第二遍按块读入并编码，位写入器跨块保持状态，内存占用与文件大小无关。
+ */
+bool HuffmanCompressFile(const std::string &inPath, const std::string &outPath)
+{
+    std::ifstream in(inPath, std::ios::binary);
+    std::ofstream out(outPath, std::ios::binary);
+    if (!in || !out)
+        return false;
+
+    std::vector<uint8_t> buf(HUF_CHUNK);
+    uint64_t freq[HUF_SYMBOLS] = {0};
+    uint64_t total = 0;
+    while (true)
+    {
+        in.read(reinterpret_cast<char *>(buf.data()), buf.size());
+        size_t got = static_cast<size_t>(in.gcount());
+        if (got == 0)
+            break;
+        HufCountFreq(buf.data(), got, freq);
+        total += got;
+    }
+
+    uint8_t len[HUF_SYMBOLS];
+    HufEncTable t;
+    HufBuildLengths(freq, len);
+    HufBuildEncTable(len, t);
+    uint8_t header[HUF_HEADER_SIZE];
+    WriteHeader(header, total, len);
+    out.write(reinterpret_cast<const char *>(header), HUF_HEADER_SIZE);
+
+    in.clear();
+    in.seekg(0);
+    std::vector<uint8_t> obuf(HufEncodeBound(t, HUF_CHUNK));
+    HufBitWriter w = {0, 0};
+    while (true)
+    {
+        in.read(reinterpret_cast<char *>(buf.data()), buf.size());
+        size_t got = static_cast<size_t>(in.gcount());
+        if (got == 0)
+            break;
+        size_t bytes = HufEncodeBlock(t, w, buf.data(), got, obuf.data());
+        out.write(reinterpret_cast<const char *>(obuf.data()), bytes);
+    }
+    size_t bytes = HufFlushBits(w, obuf.data());
+    out.write(reinterpret_cast<const char *>(obuf.data()), bytes);
+    return static_cast<bool>(out);
+}
+
+// 解压失败时关闭并删除已创建的输出文件，不留下截断的结果
+static bool DiscardOutput(std::ofstream &out, const std::string &path)
+{
+    out.close();
+    std::remove(path.c_str());
+    return false;
+}
+
+/**
+ * 流式解压文件
+ * @param inPath 压缩文件路径
+ * @param outPath 输出文件路径
+ * @return 数据完整且格式正确返回true
+ *
+ * 算法实现:
+ * 1. 读出头部并构造解码表，原始长度超过文件数据部分的总位数时拒绝；头部校验通过后才创建输出文件，
+ *    被拒绝的输入不会截断已有的输出文件。
+ * 2. 循环：把未读完的字节移到缓冲区开头并读入新数据，解码一块后写出；位读取器跨块保持状态。
+ * 3. 文件读完后以final模式解出剩余符号；中途发现数据损坏时删除已写出一部分的输出文件。
+ */
+bool HuffmanDecompressFile(const std::string &inPath, const std::string &outPath)
+{
+    std::ifstream in(inPath, std::ios::binary | std::ios::ate);
+    if (!in)
+        return false;
+    uint64_t fileSize = static_cast<uint64_t>(in.tellg());
+    in.seekg(0);
+    uint8_t header[HUF_HEADER_SIZE];
+    in.read(reinterpret_cast<char *>(header), HUF_HEADER_SIZE);
+    if (in.gcount() != HUF_HEADER_SIZE || memcmp(header, HUF_MAGIC, 4) != 0)
+        return false;
+    uint64_t remaining = GetLE64(header + 4);
+    if (remaining > 8 * (fileSize - HUF_HEADER_SIZE))
+        return false;
+    HufDecTable t;
+    if (!HufBuildDecTable(header + 12, t) || (remaining > 0 && t.maxLen == 0))
+        return false;
+    std::ofstream out(outPath, std::ios::binary);
+    if (!out)
+        return false;
+
+    std::vector<uint8_t> ibuf(HUF_CHUNK), obuf(HUF_CHUNK);
+    HufBitReader r;
+    HufInitReader(r, ibuf.data(), 0);
+    bool eof = false;
+    while (remaining > 0)
+    {
+        size_t unread = static_cast<size_t>(r.end - r.p);
+        memmove(ibuf.data(), r.p, unread);
+        if (!eof)
+        {
+            in.read(reinterpret_cast<char *>(ibuf.data()) + unread, ibuf.size() - unread);
+            unread += static_cast<size_t>(in.gcount());
+            eof = !in;
+        }
+        r.p = ibuf.data();
+        r.end = ibuf.data() + unread;
+        size_t want = static_cast<size_t>(std::min<uint64_t>(remaining, obuf.size()));
+        size_t got = HufDecodeBlock(t, r, obuf.data(), want, eof);
+        if ((eof && got < want) || (got == 0 && unread == ibuf.size()))
+            return DiscardOutput(out, outPath);
+        out.write(reinterpret_cast<const char *>(obuf.data()), got);
+        remaining -= got;
+    }
+    return out ? true : DiscardOutput(out, outPath);
+}
+
+static const uint8_t HUFP_MAGIC[4] = {'H', 'U', 'F', 'P'};
+static const size_t HUFP_ROUND_BLOCKS = 4; // 流式分块压缩时每轮每个线程分到的块数
+
+// 解析后的分块格式头部
+typedef struct
+{
+    uint64_t size;     // 原始长度
+    size_t blockSize;  // 块大小
+    uint64_t blocks;   // 块数
+    HufTableMode mode; // 编码表方式
+} HufParallelInfo;
+
+static int ResolveThreads(int threads)
+{
+    if (threads <= 0)
+        threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    return threads;
+}
+
+/**
+ * 用threads个线程并行执行fn(0) ... fn(jobs - 1)
+ * @param threads 线程数
+ * @param jobs 任务数
+ * @param fn 任务函数
+ *
+ * 算法实现:
+ * 1. 各线程通过原子游标领取下一个任务，块大小不均时也能保持负载均衡。
+ * 2. 调用线程自身也作为一个工作线程。
+ */
+template <typename F>
+static void ParallelFor(int threads, size_t jobs, F fn)
+{
+    std::atomic<size_t> cursor(0);
+    auto worker = [&]()
+    {
+        for (size_t i = cursor.fetch_add(1); i < jobs; i = cursor.fetch_add(1))
+            fn(i);
+    };
+    size_t nthreads = std::min<size_t>(static_cast<size_t>(threads), jobs);
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < nthreads; t++)
+        pool.emplace_back(worker);
+    worker();
+    for (std::thread &th : pool)
+        th.join();
+}
+
+// 第b块的长度，最后一块可能不满
+static inline size_t BlockLen(uint64_t n, size_t bs, size_t b)
+{
+    return static_cast<size_t>(std::min<uint64_t>(bs, n - static_cast<uint64_t>(b) * bs));
+}
+
+// 并行统计各块的频数，freq[b * HUF_SYMBOLS + s]为第b块中字节s的个数
+static void CountBlocks(const uint8_t *data, size_t n, size_t bs, int threads, std::vector<uint64_t> &freq)
+{
+    size_t blocks = (n + bs - 1) / bs;
+    freq.assign(blocks * HUF_SYMBOLS, 0);
+    ParallelFor(threads, blocks, [&](size_t b)
+                { HufCountFreq(data + b * bs, BlockLen(n, bs, b), &freq[b * HUF_SYMBOLS]); });
+}
+
+// 求编码长度：共用表时合并各块频数建一张表，否则各块并行建表
+static void BuildBlockLengths(const std::vector<uint64_t> &freq, int threads, bool perBlock, std::vector<uint8_t> &lens)
+{
+    size_t blocks = freq.size() / HUF_SYMBOLS;
+    if (perBlock)
+    {
+        lens.resize(blocks * HUF_SYMBOLS);
+        ParallelFor(threads, blocks, [&](size_t b)
+                    { HufBuildLengths(&freq[b * HUF_SYMBOLS], &lens[b * HUF_SYMBOLS]); });
+        return;
+    }
+    uint64_t total[HUF_SYMBOLS] = {0};
+    for (size_t b = 0; b < blocks; b++)
+    {
+        for (int s = 0; s < HUF_SYMBOLS; s++)
+            total[s] += freq[b * HUF_SYMBOLS + s];
+    }
+    lens.resize(HUF_SYMBOLS);
+    HufBuildLengths(total, lens.data());
+}
+
+// 由频数和编码长度精确求出各块压缩后的偏移，offset[0]为base，offset[blocks]为末尾
+static void PlanBlocks(const std::vector<uint64_t> &freq, const uint8_t *lens, bool perBlock, uint64_t base,
+                       std::vector<uint64_t> &offset)
+{
+    size_t blocks = freq.size() / HUF_SYMBOLS;
+    offset.resize(blocks + 1);
+    offset[0] = base;
+    for (size_t b = 0; b < blocks; b++)
+    {
+        const uint8_t *l = perBlock ? lens + b * HUF_SYMBOLS : lens;
+        uint64_t bits = 0;
+        for (int s = 0; s < HUF_SYMBOLS; s++)
+            bits += freq[b * HUF_SYMBOLS + s] * l[s];
+        offset[b + 1] = offset[b] + (perBlock ? HUF_SYMBOLS : 0) + (bits + 7) / 8;
+    }
+}
+
+/**
+ * 并行编码各块，每块写到offset预先算好的位置
+ * @param data 输入数据
+ * @param n 输入长度
+ * @param bs 块大小
+ * @param threads 线程数
+ * @param lens 编码长度（共用一张或每块一张）
+ * @param perBlock 是否每块单独建表
+ * @param offset 各块的偏移
+ * @param dst 输出位置，对应offset[0]
+ *
+ * 算法实现:
+ * 1. 每块使用独立的位写入器，块末尾按字节补齐，块之间互不依赖。
+ * 2. 每块单独建表时，先写出该块的256个编码长度。
+ */
+static void EncodeBlocks(const uint8_t *data, size_t n, size_t bs, int threads, const uint8_t *lens, bool perBlock,
+                         const std::vector<uint64_t> &offset, uint8_t *dst)
+{
+    HufEncTable shared;
+    if (!perBlock)
+        HufBuildEncTable(lens, shared);
+    ParallelFor(threads, offset.size() - 1, [&](size_t b)
+                {
+        uint8_t *o = dst + (offset[b] - offset[0]);
+        HufEncTable local;
+        const HufEncTable *t = &shared;
+        if (perBlock)
+        {
+            const uint8_t *l = lens + b * HUF_SYMBOLS;
+            HufBuildEncTable(l, local);
+            memcpy(o, l, HUF_SYMBOLS);
+            o += HUF_SYMBOLS;
+            t = &local;
+        }
+        HufBitWriter w = {0, 0};
+        size_t k = HufEncodeBlock(*t, w, data + b * bs, BlockLen(n, bs, b), o);
+        HufFlushBits(w, o + k); });
+}
+
+/**
+ * 并行解码各块
+ * @param payload 第一块的起点，对应offset[0]
+ * @param offset 各块的偏移，共blocks + 1项
+ * @param blocks 块数
+ * @param shared 共用的解码表，为nullptr时每块自带编码长度
+ * @param out 输出位置
+ * @param n 这些块解压后的总长度
+ * @param bs 块大小
+ * @param threads 线程数
+ * @return 所有块都完整解出返回true
+ */
+static bool DecodeBlocks(const uint8_t *payload, const uint64_t *offset, size_t blocks, const HufDecTable *shared,
+                         uint8_t *out, uint64_t n, size_t bs, int threads)
+{
+    std::atomic<bool> ok(true);
+    ParallelFor(threads, blocks, [&](size_t b)
+                {
+        const uint8_t *p = payload + (offset[b] - offset[0]);
+        size_t len = static_cast<size_t>(offset[b + 1] - offset[b]);
+        HufDecTable local;
+        const HufDecTable *t = shared;
+        if (!shared)
+        {
+            if (len < HUF_SYMBOLS || !HufBuildDecTable(p, local) || local.maxLen == 0)
+            {
+                ok = false;
+                return;
+            }
+            t = &local;
+            p += HUF_SYMBOLS;
+            len -= HUF_SYMBOLS;
+        }
+        HufBitReader r;
+        HufInitReader(r, p, len);
+        size_t want = BlockLen(n, bs, b);
+        if (HufDecodeBlock(*t, r, out + b * bs, want, true) != want)
+            ok = false; });
+    return ok;
+}
+
+static void PutLE32(uint8_t *p, uint32_t v)
+{
+    for (int i = 0; i < 4; i++)
+        p[i] = static_cast<uint8_t>(v >> (8 * i));
+}
+
+static uint32_t GetLE32(const uint8_t *p)
+{
+    uint32_t v = 0;
+    for (int i = 0; i < 4; i++)
+        v |= static_cast<uint32_t>(p[i]) << (8 * i);
+    return v;
+}
+
+// 分块格式的头部长度：固定部分 + 共用编码长度 + 块偏移索引
+static uint64_t ParallelHeaderSize(HufTableMode mode, uint64_t blocks)
+{
+    return HUFP_FIXED_SIZE + (mode == HUF_SHARED_TABLE ? HUF_SYMBOLS : 0) + (blocks + 1) * 8;
+}
+
+// 写出分块格式头部的固定部分和共用编码长度，块偏移索引另行写出
+static void WriteParallelHeader(uint8_t *p, const HufParallelInfo &info, const uint8_t *lens)
+{
+    memcpy(p, HUFP_MAGIC, 4);
+    PutLE64(p + 4, info.size);
+    PutLE32(p + 12, static_cast<uint32_t>(info.blockSize));
+    PutLE64(p + 16, info.blocks);
+    p[24] = static_cast<uint8_t>(info.mode);
+    if (info.mode == HUF_SHARED_TABLE)
+        memcpy(p + HUFP_FIXED_SIZE, lens, HUF_SYMBOLS);
+}
+
+// 解析分块格式头部的固定部分
+static bool ParseParallelHeader(const uint8_t *p, HufParallelInfo &info)
+{
+    if (memcmp(p, HUFP_MAGIC, 4) != 0 || p[24] > HUF_BLOCK_TABLES)
+        return false;
+    info.size = GetLE64(p + 4);
+    info.blockSize = GetLE32(p + 12);
+    info.blocks = GetLE64(p + 16);
+    info.mode = static_cast<HufTableMode>(p[24]);
+    return info.blockSize > 0 && info.blocks == (info.size + info.blockSize - 1) / info.blockSize;
+}
+
+static void WriteIndex(uint8_t *p, const uint64_t *offset, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        PutLE64(p + 8 * i, offset[i]);
+}
+
+// 读出块偏移索引并检查其单调不减且不超过limit
+static bool ReadIndex(const uint8_t *p, size_t count, uint64_t limit, std::vector<uint64_t> &offset)
+{
+    offset.resize(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        offset[i] = GetLE64(p + 8 * i);
+        if ((i == 0 && offset[i] != 0) || (i > 0 && offset[i] < offset[i - 1]) || offset[i] > limit)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * 分块并行压缩内存中的数据
+ * @param data 输入数据
+ * @param n 输入长度
+ * @param out 压缩结果
+ * @param threads 线程数，0表示使用硬件并发数
+ * @param mode 编码表方式
+ * @param blockSize 块大小
+ * @return 是否成功
+ *
+ * 算法实现:
+ * 1. 把输入切成blockSize大小的独立块，各线程领取块并行统计频数。
+ * 2. 共用表时合并频数建一张表；否则各块并行建表。
+ * 3. 由频数和编码长度精确算出每块压缩后的长度，前缀和得到块偏移索引，一次分配输出。
+ * 4. 各线程把块直接编码到索引指定的位置，无需再拼接。
+ *
+ * 格式: "HUFP"、原始长度(8)、块大小(4)、块数(8)、编码表方式(1)、[共用编码长度(256)]、块偏移索引((块数 + 1) * 8)、各块数据。
+ */
+bool HuffmanCompressParallel(const uint8_t *data, size_t n, std::vector<uint8_t> &out, int threads,
+                             HufTableMode mode, size_t blockSize)
+{
+    if (blockSize == 0 || blockSize > 0xffffffffu)
+        return false;
+    threads = ResolveThreads(threads);
+    bool perBlock = mode == HUF_BLOCK_TABLES;
+    HufParallelInfo info = {n, blockSize, (n + blockSize - 1) / blockSize, mode};
+
+    std::vector<uint64_t> freq, offset;
+    std::vector<uint8_t> lens;
+    CountBlocks(data, n, blockSize, threads, freq);
+    BuildBlockLengths(freq, threads, perBlock, lens);
+    PlanBlocks(freq, lens.data(), perBlock, 0, offset);
+
+    size_t head = static_cast<size_t>(ParallelHeaderSize(mode, info.blocks));
+    out.resize(head + offset.back());
+    WriteParallelHeader(out.data(), info, lens.data());
+    WriteIndex(out.data() + head - offset.size() * 8, offset.data(), offset.size());
+    EncodeBlocks(data, n, blockSize, threads, lens.data(), perBlock, offset, out.data() + head);
+    return true;
+}
+
+/**
+ * 分块并行解压内存中的数据
+ * @param data 压缩数据
+ * @param n 压缩数据长度
+ * @param out 解压结果
+ * @param threads 线程数，0表示使用硬件并发数
+ * @return 数据完整且格式正确返回true
+ *
+ * 算法实现:
+ * 1. 解析头部和块偏移索引，共用表时只构造一次解码表；原始长度超过各块数据的总位数时拒绝，不做分配。
+ * 2. 第b块解压后位于b * blockSize处，各线程按索引定位各块并行解码。
+ */
+bool HuffmanDecompressParallel(const uint8_t *data, size_t n, std::vector<uint8_t> &out, int threads)
+{
+    HufParallelInfo info;
+    if (n < HUFP_FIXED_SIZE || !ParseParallelHeader(data, info) || info.blocks > n / 8)
+        return false;
+    uint64_t head = ParallelHeaderSize(info.mode, info.blocks);
+    if (head > n || info.size > 8 * (n - head))
+        return false;
+    std::vector<uint64_t> offset;
+    if (!ReadIndex(data + head - (info.blocks + 1) * 8, info.blocks + 1, n - head, offset))
+        return false;
+
+    HufDecTable shared;
+    if (info.mode == HUF_SHARED_TABLE &&
+        (!HufBuildDecTable(data + HUFP_FIXED_SIZE, shared) || (info.size > 0 && shared.maxLen == 0)))
+        return false;
+    out.resize(info.size);
+    return DecodeBlocks(data + head, offset.data(), info.blocks, info.mode == HUF_SHARED_TABLE ? &shared : nullptr,
+                        out.data(), info.size, info.blockSize, ResolveThreads(threads));
+}
+
+/**
+ * 分块并行压缩文件
+ * @param inPath 输入文件路径
+ * @param outPath 输出文件路径
+ * @param threads 线程数，0表示使用硬件并发数
+ * @param mode 编码表方式
+ * @param blockSize 块大小
+ * @return 是否成功
+ *
+ * 算法实现:
+ * 1. 每轮读入threads * HUFP_ROUND_BLOCKS个块，内存占用与文件大小无关。
+ * 2. 共用表时先完整读一遍，逐轮并行统计频数后建表。
+ * 3. 写出头部并为块偏移索引留出位置；之后逐轮并行统计、规划、编码并写出，累计块偏移。
+ * 4. 最后回到索引位置写出块偏移索引。
+ */
+bool HuffmanCompressFileParallel(const std::string &inPath, const std::string &outPath, int threads,
+                                 HufTableMode mode, size_t blockSize)
+{
+    if (blockSize == 0 || blockSize > 0xffffffffu)
+        return false;
+    std::ifstream in(inPath, std::ios::binary | std::ios::ate);
+    std::ofstream out(outPath, std::ios::binary);
+    if (!in || !out)
+        return false;
+    threads = ResolveThreads(threads);
+    bool perBlock = mode == HUF_BLOCK_TABLES;
+    uint64_t size = static_cast<uint64_t>(in.tellg());
+    HufParallelInfo info = {size, blockSize, (size + blockSize - 1) / blockSize, mode};
+    size_t roundBlocks = static_cast<size_t>(threads) * HUFP_ROUND_BLOCKS;
+    uint64_t roundBytes = static_cast<uint64_t>(roundBlocks) * blockSize;
+    std::vector<uint8_t> buf(static_cast<size_t>(std::min(roundBytes, size)));
+    std::vector<uint64_t> freq, offset;
+    std::vector<uint8_t> lens, obuf;
+
+    // 读入第b0块开始的一轮数据，返回字节数
+    auto readRound = [&](uint64_t b0) -> size_t
+    {
+        size_t got = static_cast<size_t>(std::min(roundBytes, size - b0 * blockSize));
+        in.read(reinterpret_cast<char *>(buf.data()), got);
+        return static_cast<size_t>(in.gcount()) == got ? got : 0;
+    };
+
+    if (!perBlock)
+    {
+        uint64_t total[HUF_SYMBOLS] = {0};
+        in.seekg(0);
+        for (uint64_t b0 = 0; b0 < info.blocks; b0 += roundBlocks)
+        {
+            size_t got = readRound(b0);
+            if (got == 0)
+                return false;
+            CountBlocks(buf.data(), got, blockSize, threads, freq);
+            for (size_t i = 0; i < freq.size(); i++)
+                total[i % HUF_SYMBOLS] += freq[i];
+        }
+        lens.resize(HUF_SYMBOLS);
+        HufBuildLengths(total, lens.data());
+    }
+
+    uint64_t head = ParallelHeaderSize(mode, info.blocks);
+    std::vector<uint8_t> header(static_cast<size_t>(head - (info.blocks + 1) * 8));
+    WriteParallelHeader(header.data(), info, lens.data());
+    out.write(reinterpret_cast<const char *>(header.data()), header.size());
+    std::vector<uint64_t> index(info.blocks + 1, 0);
+    std::vector<uint8_t> raw(index.size() * 8, 0);
+    out.write(reinterpret_cast<const char *>(raw.data()), raw.size());
+
+    in.clear();
+    in.seekg(0);
+    for (uint64_t b0 = 0; b0 < info.blocks; b0 += roundBlocks)
+    {
+        size_t got = readRound(b0);
+        if (got == 0)
+            return false;
+        CountBlocks(buf.data(), got, blockSize, threads, freq);
+        if (perBlock)
+            BuildBlockLengths(freq, threads, true, lens);
+        PlanBlocks(freq, lens.data(), perBlock, index[b0], offset);
+        std::copy(offset.begin(), offset.end(), index.begin() + b0);
+        obuf.resize(static_cast<size_t>(offset.back() - offset[0]));
+        EncodeBlocks(buf.data(), got, blockSize, threads, lens.data(), perBlock, offset, obuf.data());
+        out.write(reinterpret_cast<const char *>(obuf.data()), obuf.size());
+    }
+
+    WriteIndex(raw.data(), index.data(), index.size());
+    out.seekp(static_cast<std::streamoff>(header.size()));
+    out.write(reinterpret_cast<const char *>(raw.data()), raw.size());
+    return static_cast<bool>(out);
+}
+
+/**
+ * 分块并行解压文件
+ * @param inPath 压缩文件路径
+ * @param outPath 输出文件路径
+ * @param threads 线程数，0表示使用硬件并发数
+ * @return 数据完整且格式正确返回true
+ *
+ * 算法实现:
+ * 1. 读出头部和块偏移索引，共用表时只构造一次解码表；原始长度超过文件中数据部分的总位数时拒绝。
+ * 2. 头部和索引都校验通过后才创建输出文件，被拒绝的输入不会截断已有的输出文件。
+ * 3. 每轮按索引读入threads * HUFP_ROUND_BLOCKS个块的压缩数据，输出长度超过这些数据的位数时拒绝，否则并行解码后写出；
+ *    中途失败时删除已写出一部分的输出文件。
+ */
+bool HuffmanDecompressFileParallel(const std::string &inPath, const std::string &outPath, int threads)
+{
+    std::ifstream in(inPath, std::ios::binary | std::ios::ate);
+    if (!in)
+        return false;
+    threads = ResolveThreads(threads);
+    uint64_t fileSize = static_cast<uint64_t>(in.tellg());
+    in.seekg(0);
+
+    uint8_t fixed[HUFP_FIXED_SIZE + HUF_SYMBOLS];
+    HufParallelInfo info;
+    in.read(reinterpret_cast<char *>(fixed), HUFP_FIXED_SIZE);
+    if (in.gcount() != HUFP_FIXED_SIZE || !ParseParallelHeader(fixed, info) || info.blocks > fileSize / 8)
+        return false;
+    uint64_t head = ParallelHeaderSize(info.mode, info.blocks);
+    if (head > fileSize || info.size > 8 * (fileSize - head))
+        return false;
+
+    HufDecTable shared;
+    if (info.mode == HUF_SHARED_TABLE)
+    {
+        in.read(reinterpret_cast<char *>(fixed + HUFP_FIXED_SIZE), HUF_SYMBOLS);
+        if (!HufBuildDecTable(fixed + HUFP_FIXED_SIZE, shared) || (info.size > 0 && shared.maxLen == 0))
+            return false;
+    }
+    std::vector<uint8_t> raw(static_cast<size_t>((info.blocks + 1) * 8));
+    std::vector<uint64_t> index;
+    in.read(reinterpret_cast<char *>(raw.data()), raw.size());
+    if (!in || !ReadIndex(raw.data(), raw.size() / 8, fileSize - head, index))
+        return false;
+    std::ofstream out(outPath, std::ios::binary);
+    if (!out)
+        return false;
+
+    size_t roundBlocks = static_cast<size_t>(threads) * HUFP_ROUND_BLOCKS;
+    std::vector<uint8_t> ibuf, obuf;
+    for (uint64_t b0 = 0; b0 < info.blocks; b0 += roundBlocks)
+    {
+        size_t k = static_cast<size_t>(std::min<uint64_t>(roundBlocks, info.blocks - b0));
+        ibuf.resize(static_cast<size_t>(index[b0 + k] - index[b0]));
+        in.read(reinterpret_cast<char *>(ibuf.data()), ibuf.size());
+        if (static_cast<size_t>(in.gcount()) != ibuf.size())
+            return DiscardOutput(out, outPath);
+        uint64_t outLen = std::min<uint64_t>(static_cast<uint64_t>(k) * info.blockSize, info.size - b0 * info.blockSize);
+        if (outLen > 8 * static_cast<uint64_t>(ibuf.size()))
+            return DiscardOutput(out, outPath);
+        obuf.resize(static_cast<size_t>(outLen));
+        if (!DecodeBlocks(ibuf.data(), &index[b0], k, info.mode == HUF_SHARED_TABLE ? &shared : nullptr,
+                          obuf.data(), outLen, info.blockSize, threads))
+            return DiscardOutput(out, outPath);
+        out.write(reinterpret_cast<const char *>(obuf.data()), obuf.size());
+    }
+    return out ? true : DiscardOutput(out, outPath);
+}
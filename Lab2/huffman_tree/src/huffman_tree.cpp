@@ -1,4 +1,6 @@
 #include "huffman_tree.h"
+#include <algorithm>
+#include <vector>
 
 /**
  * 初始化赫夫曼树
@@ -7,11 +9,30 @@
  * @param n 叶子节点数
  *
  * 算法实现:
+ * 1. 将权重转换为64位后调用InitHTree(HTree &, const HTWeight *, int)。
+ */
+void InitHTree(HTree &HT, int *w, int n)
+{
+    HTWeight *w64 = new HTWeight[n];
+    for (int i = 0; i < n; i++)
+        w64[i] = w[i];
+    InitHTree(HT, w64, n);
+    delete[] w64;
+}
+
+/**
+ * 以64位权重初始化赫夫曼树
+ * @param HT 赫夫曼树
+ * @param w 权重数组
+ * @param n 叶子节点数
+ *
+ * 算法实现:
  * 1. 计算赫夫曼树的总节点数。
  * 2. 初始化前n个节点为叶子节点，设置权重和父子关系。
  * 3. 初始化剩余节点为非叶子节点，设置权重和父子关系。
+ * 4. 权重按64位保存，适用于大文件的真实频数。
  */
-void InitHTree(HTree &HT, int *w, int n)
+void InitHTree(HTree &HT, const HTWeight *w, int n)
 {
     int m = 2 * n - 1; // 总结点数
     HT = new HTNode[m];
@@ -70,14 +91,31 @@ void Select(HTree HT, int n, int &s1, int &s2)
  * 构造赫夫曼树
  * @param HT 赫夫曼树
  * @param n 叶子节点数
+ * @param mode 构造方式
  *
  * 算法实现:
- * 1. 计算赫夫曼树的总节点数。
- * 2. 依次选择两个最小权重的节点，构造新的父节点。
- * 3. 更新父子关系和权重。
+ * 1. 非HT_SELECT方式分别交给CreateHTreeHeap和CreateHTreeTwoQueue。
+ * 2. 计算赫夫曼树的总节点数。
+ * 3. 依次选择两个最小权重的节点，构造新的父节点。
+ * 4. 更新父子关系和权重。
  */
-void CreateHTree(HTree &HT, int n)
+void CreateHTree(HTree &HT, int n, HTBuildMode mode)
 {
+    switch (mode)
+    {
+    case HT_HEAP2:
+        CreateHTreeHeap(HT, n, 2);
+        return;
+    case HT_HEAP4:
+        CreateHTreeHeap(HT, n, 4);
+        return;
+    case HT_TWO_QUEUE:
+        CreateHTreeTwoQueue(HT, n);
+        return;
+    default:
+        break;
+    }
+
     int m = 2 * n - 1; // 总结点数
     for (int i = n; i < m; i++)
     {
@@ -91,6 +129,141 @@ void CreateHTree(HTree &HT, int n)
     }
 }
 
+// 堆元素：直接携带权重，比较时无需再访问HT数组
+typedef struct
+{
+    HTWeight weight;
+    int index;
+} HTHeapItem;
+
+/**
+ * 比较两个堆元素的优先级：权重小者优先，权重相同时下标小者优先
+ * @param a 堆元素
+ * @param b 堆元素
+ * @return a是否优先于b
+ */
+static inline bool HTLess(const HTHeapItem &a, const HTHeapItem &b)
+{
+    return a.weight < b.weight || (a.weight == b.weight && a.index < b.index);
+}
+
+/**
+ * d叉最小堆的下沉操作
+ * @param heap 堆
+ * @param size 堆中元素个数
+ * @param i 下沉的起始位置
+ * @param arity 堆的叉数
+ */
+static void SiftDown(HTHeapItem *heap, int size, int i, int arity)
+{
+    HTHeapItem x = heap[i];
+    while (true)
+    {
+        int first = i * arity + 1;
+        if (first >= size)
+            break;
+        int last = first + arity < size ? first + arity : size;
+        int best = first;
+        for (int c = first + 1; c < last; c++)
+        {
+            if (HTLess(heap[c], heap[best]))
+                best = c;
+        }
+        if (!HTLess(heap[best], x))
+            break;
+        heap[i] = heap[best];
+        i = best;
+    }
+    heap[i] = x;
+}
+
+/**
+ * 基于d叉最小堆构造赫夫曼树
+ * @param HT 赫夫曼树
+ * @param n 叶子节点数
+ * @param arity 堆的叉数（2或4，四叉堆层数更少、同一结点的孩子在同一缓存行内）
+ *
+ * 算法实现:
+ * 1. 把n个叶子的(权重, 下标)建成最小堆，自底向上建堆为O(n)。
+ * 2. 弹出堆顶得到s1，此时堆顶即为s2；新结点i直接替换堆顶并下沉，省去一次弹出和一次插入。
+ * 3. 共n-1次合并，每次O(log n)，总代价O(n log n)。
+ */
+void CreateHTreeHeap(HTree &HT, int n, int arity)
+{
+    if (arity < 2)
+        arity = 2;
+    int m = 2 * n - 1;
+    HTHeapItem *heap = new HTHeapItem[n > 0 ? n : 1];
+    int size = n;
+    for (int i = 0; i < n; i++)
+    {
+        heap[i].weight = HT[i].weight;
+        heap[i].index = i;
+    }
+    for (int i = (n - 2) / arity; i >= 0; i--)
+        SiftDown(heap, size, i, arity);
+
+    for (int i = n; i < m; i++)
+    {
+        int s1 = heap[0].index;
+        heap[0] = heap[--size];
+        SiftDown(heap, size, 0, arity);
+        int s2 = heap[0].index;
+
+        HT[i].weight = HT[s1].weight + HT[s2].weight;
+        HT[i].lchild = s1;
+        HT[i].rchild = s2;
+        HT[s1].parent = i;
+        HT[s2].parent = i;
+
+        heap[0].weight = HT[i].weight;
+        heap[0].index = i;
+        SiftDown(heap, size, 0, arity);
+    }
+    delete[] heap;
+}
+
+/**
+ * 双队列法构造赫夫曼树
+ * @param HT 赫夫曼树
+ * @param n 叶子节点数
+ *
+ * 算法实现:
+ * 1. 要求叶子权重非递减；若不满足则退回CreateHTreeHeap。
+ * 2. 叶子按下标构成第一个队列，新结点按生成顺序构成第二个队列，两个新结点的权重必然非递减。
+ * 3. 每次从两个队首中取较小者两次（权重相同优先取叶子），合并代价O(1)，总代价O(n)。
+ */
+void CreateHTreeTwoQueue(HTree &HT, int n)
+{
+    for (int i = 1; i < n; i++)
+    {
+        if (HT[i].weight < HT[i - 1].weight)
+        {
+            CreateHTreeHeap(HT, n, 4);
+            return;
+        }
+    }
+
+    int m = 2 * n - 1;
+    int leaf = 0, inner = n; // 两个队列的队首
+    for (int i = n; i < m; i++)
+    {
+        int s[2];
+        for (int k = 0; k < 2; k++)
+        {
+            if (leaf < n && (inner >= i || HT[leaf].weight <= HT[inner].weight))
+                s[k] = leaf++;
+            else
+                s[k] = inner++;
+        }
+        HT[i].weight = HT[s[0]].weight + HT[s[1]].weight;
+        HT[i].lchild = s[0];
+        HT[i].rchild = s[1];
+        HT[s[0]].parent = i;
+        HT[s[1]].parent = i;
+    }
+}
+
 /**
  * 生成赫夫曼编码
  * @param HT 赫夫曼树
@@ -133,3 +306,155 @@ void HTCoding(HTree HT, HTCode &HC, int n)
 
     delete[] cd;
 }
+
+/**
+ * 由赫夫曼树求各叶子的编码长度
+ * @param HT 已构造的赫夫曼树
+ * @param n 叶子节点数
+ * @param len 返回各叶子的编码长度
+ *
+ * 算法实现:
+ * 1. 根结点下标为2n-2，且孩子下标总小于双亲下标。
+ * 2. 从根开始按下标递减扫描一次，孩子深度 = 双亲深度 + 1，不生成编码字符串。
+ * 3. 只有一个叶子时编码长度记为1。
+ */
+void HTCodeLengths(HTree HT, int n, int *len)
+{
+    if (n == 1)
+    {
+        len[0] = 1;
+        return;
+    }
+    std::vector<int> depth(2 * n - 1);
+    depth[2 * n - 2] = 0;
+    for (int i = 2 * n - 2; i >= n; i--)
+    {
+        depth[HT[i].lchild] = depth[i] + 1;
+        depth[HT[i].rchild] = depth[i] + 1;
+    }
+    for (int i = 0; i < n; i++)
+        len[i] = depth[i];
+}
+
+/**
+ * 求长度受限的最优编码长度（package-merge算法）
+ * @param w 权重数组
+ * @param n 叶子节点数
+ * @param maxLen 编码长度上限
+ * @param len 返回各叶子的编码长度
+ * @return n超过2^maxLen时无法满足上限，返回false
+ *
+ * 算法实现:
+ * 1. 将叶子按权重从小到大排序，最深一层的列表就是叶子本身。
+ * 2. 从第maxLen-1层到第1层：把下一层列表相邻两项打包，与叶子归并成本层列表，记录每项是否为叶子。
+ * 3. 在第1层选前2n-2项；其中的叶子编码长度各加1，打包项展开为下一层的前2倍项，逐层向下重复。
+ * 4. 每层选中的叶子总是排序后叶子的一个前缀，因此只需统计前缀长度。
+ */
+bool HTLimitedLengths(const HTWeight *w, int n, int maxLen, int *len)
+{
+    for (int i = 0; i < n; i++)
+        len[i] = 0;
+    if (n <= 0)
+        return true;
+    if (n == 1)
+    {
+        len[0] = 1;
+        return true;
+    }
+    if (maxLen < 1 || (maxLen < 31 && n > (1 << maxLen)))
+        return false;
+
+    std::vector<int> order(n);
+    for (int i = 0; i < n; i++)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [w](int a, int b)
+                     { return w[a] < w[b]; });
+    std::vector<HTWeight> leaf(n);
+    for (int i = 0; i < n; i++)
+        leaf[i] = w[order[i]];
+
+    // isLeaf[j]记录第j+1层列表中每项是否为叶子
+    std::vector<std::vector<char>> isLeaf(maxLen);
+    std::vector<HTWeight> prev(leaf), cur;
+    isLeaf[maxLen - 1].assign(n, 1);
+    for (int j = maxLen - 2; j >= 0; j--)
+    {
+        size_t packs = prev.size() / 2;
+        size_t a = 0, b = 0;
+        cur.clear();
+        isLeaf[j].clear();
+        while (a < leaf.size() || b < packs)
+        {
+            if (b >= packs || (a < leaf.size() && leaf[a] <= prev[2 * b] + prev[2 * b + 1]))
+            {
+                cur.push_back(leaf[a++]);
+                isLeaf[j].push_back(1);
+            }
+            else
+            {
+                cur.push_back(prev[2 * b] + prev[2 * b + 1]);
+                isLeaf[j].push_back(0);
+                b++;
+            }
+        }
+        prev.swap(cur);
+    }
+
+    size_t take = 2 * static_cast<size_t>(n) - 2;
+    for (int j = 0; j < maxLen && take > 0; j++)
+    {
+        size_t leaves = 0;
+        for (size_t i = 0; i < take; i++)
+            leaves += isLeaf[j][i];
+        for (size_t i = 0; i < leaves; i++)
+            len[order[i]]++;
+        take = 2 * (take - leaves);
+    }
+    return true;
+}
+
+/**
+ * 由编码长度生成规范赫夫曼编码
+ * @param len 各叶子的编码长度，0表示不参与编码
+ * @param n 叶子节点数
+ * @param HCC 规范编码表
+ * @return 长度超过32或不满足Kraft不等式时返回false
+ *
+ * 算法实现:
+ * 1. 统计每种长度的叶子数，检查Kraft不等式。
+ * 2. 长度为l的首码为(长度为l-1的首码 + 长度为l-1的叶子数) << 1。
+ * 3. 同一长度内按下标从小到大分配连续编码，解码端只需知道长度即可重建编码。
+ */
+bool HTCanonicalCoding(const int *len, int n, HTCanonCode &HCC)
+{
+    const int MAXLEN = 32;
+    unsigned long long count[MAXLEN + 1] = {0}, next[MAXLEN + 1] = {0};
+    unsigned long long kraft = 0;
+    HCC = nullptr;
+    for (int i = 0; i < n; i++)
+    {
+        if (len[i] < 0 || len[i] > MAXLEN)
+            return false;
+        if (len[i])
+        {
+            count[len[i]]++;
+            kraft += 1ULL << (MAXLEN - len[i]);
+        }
+    }
+    if (kraft > (1ULL << MAXLEN))
+        return false;
+
+    unsigned long long code = 0;
+    for (int l = 1; l <= MAXLEN; l++)
+    {
+        code = (code + count[l - 1]) << 1;
+        next[l] = code;
+    }
+    HCC = new HTCodeWord[n];
+    for (int i = 0; i < n; i++)
+    {
+        HCC[i].len = len[i];
+        HCC[i].code = len[i] ? static_cast<unsigned int>(next[len[i]]++) : 0;
+    }
+    return true;
+}
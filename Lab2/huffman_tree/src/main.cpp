@@ -1,7 +1,11 @@
 #include <iostream>
 #include <vector>
+#include <fstream>
+#include <cstdio>
 #include <tabulate/table.hpp>
 #include "huffman_tree.h"
+#include "huffman_codec.h"
+#include "adaptive_huffman.h"
 
 using namespace std;
 using namespace tabulate;
@@ -61,6 +65,129 @@ int main()
     }
     cout << huffman_code_table << endl;
 
+    // (4) 规范编码与长度受限编码
+    vector<int> len(n), limited(n);
+    vector<HTWeight> w64(w, w + n);
+    HTCanonCode HCC, LCC;
+    HTCodeLengths(HT, n, len.data());
+    HTLimitedLengths(w64.data(), n, 3, limited.data());
+    HTCanonicalCoding(len.data(), n, HCC);
+    HTCanonicalCoding(limited.data(), n, LCC);
+    auto bits = [](const HTCodeWord &c)
+    {
+        string s;
+        for (int k = c.len - 1; k >= 0; k--)
+            s += (c.code >> k & 1) ? '1' : '0';
+        return s;
+    };
+    cout << "\n规范编码（右侧为最大长度3的受限编码）：" << endl;
+    Table canonical_table;
+    canonical_table.add_row({"node", "weight", "canonical", "limited(3)"});
+    for (int i = 0; i < n; i++)
+    {
+        canonical_table.add_row({to_string(i), to_string(w[i]), bits(HCC[i]), bits(LCC[i])});
+    }
+    canonical_table[0].format().font_color(Color::yellow); // 表头颜色
+    for (int i = 1; i <= n; i++)
+    {
+        canonical_table[i].format().font_color(Color::cyan); // 内容颜色
+    }
+    cout << canonical_table << endl;
+    delete[] HCC;
+    delete[] LCC;
+
+    // (5) 压缩与解压
+    string text;
+    for (int i = 0; i < 200; i++)
+    {
+        text += "this is an example of a huffman tree, ";
+    }
+    const uint8_t *raw = reinterpret_cast<const uint8_t *>(text.data());
+    vector<uint8_t> packed, unpacked, ppacked, punpacked;
+    HuffmanCompress(raw, text.size(), packed);
+    bool ok = HuffmanDecompress(packed.data(), packed.size(), unpacked) &&
+              string(unpacked.begin(), unpacked.end()) == text;
+    // 损坏的头部：原始长度改为远超数据位数的值、截断到头部以内，都应返回false而不是分配内存
+    vector<uint8_t> corrupt(packed);
+    fill(corrupt.begin() + 4, corrupt.begin() + 12, 0x7f);
+    bool rejected = !HuffmanDecompress(corrupt.data(), corrupt.size(), unpacked) &&
+                    !HuffmanDecompress(packed.data(), HUF_HEADER_SIZE - 1, unpacked);
+    HuffmanCompressParallel(raw, text.size(), ppacked, 0, HUF_BLOCK_TABLES, 1024); // 分块并行，每块单独建表
+    bool pok = HuffmanDecompressParallel(ppacked.data(), ppacked.size(), punpacked) &&
+               string(punpacked.begin(), punpacked.end()) == text;
+    // 分块格式同样：原始长度与块大小一起放大（块数仍一致），应被拒绝
+    vector<uint8_t> pcorrupt(ppacked);
+    uint64_t blocks = 0;
+    for (int i = 0; i < 8; i++)
+        blocks |= static_cast<uint64_t>(pcorrupt[16 + i]) << (8 * i);
+    uint64_t fakeSize = blocks * 0xffffffffull;
+    for (int i = 0; i < 8; i++)
+        pcorrupt[4 + i] = static_cast<uint8_t>(fakeSize >> (8 * i));
+    fill(pcorrupt.begin() + 12, pcorrupt.begin() + 16, 0xff);
+    bool prejected = !HuffmanDecompressParallel(pcorrupt.data(), pcorrupt.size(), punpacked);
+    // 文件流式接口：两种格式各往返一次；损坏头部的分块文件应被拒绝，且不截断已有的输出文件
+    auto writeFile = [](const char *path, const void *p, size_t len)
+    {
+        ofstream f(path, ios::binary);
+        f.write(static_cast<const char *>(p), len);
+    };
+    auto readFile = [](const char *path)
+    {
+        ifstream f(path, ios::binary);
+        return string((istreambuf_iterator<char>(f)), istreambuf_iterator<char>());
+    };
+    writeFile("huf_demo.txt", text.data(), text.size());
+    bool fok = HuffmanCompressFile("huf_demo.txt", "huf_demo.huf") &&
+               HuffmanDecompressFile("huf_demo.huf", "huf_demo.out") && readFile("huf_demo.out") == text;
+    size_t fsize = readFile("huf_demo.huf").size();
+    bool pfok = HuffmanCompressFileParallel("huf_demo.txt", "huf_demo.hufp", 0, HUF_BLOCK_TABLES, 1024) &&
+                HuffmanDecompressFileParallel("huf_demo.hufp", "huf_demo.out") && readFile("huf_demo.out") == text;
+    size_t pfsize = readFile("huf_demo.hufp").size();
+    writeFile("huf_demo.hufp", pcorrupt.data(), pcorrupt.size());
+    bool pfrejected = !HuffmanDecompressFileParallel("huf_demo.hufp", "huf_demo.out") &&
+                      readFile("huf_demo.out") == text;
+    for (const char *path : {"huf_demo.txt", "huf_demo.huf", "huf_demo.hufp", "huf_demo.out"})
+        std::remove(path);
+    // 自适应编码：一遍扫描，按64字节一段流式输入，解码端按7字节一段流式输入
+    vector<uint8_t> apacked, aunpacked;
+    AHEncoder enc;
+    AHDecoder dec;
+    AHEncoderInit(enc);
+    for (size_t i = 0; i < text.size(); i += 64)
+    {
+        AHEncode(enc, raw + i, min<size_t>(64, text.size() - i), apacked);
+    }
+    AHEncodeFinish(enc, apacked);
+    AHDecoderInit(dec);
+    bool aok = true;
+    for (size_t i = 0; i < apacked.size(); i += 7)
+    {
+        aok = AHDecode(dec, apacked.data() + i, min<size_t>(7, apacked.size() - i), aunpacked) && aok;
+    }
+    aok = aok && dec.done && string(aunpacked.begin(), aunpacked.end()) == text;
+    cout << "\n压缩与解压：" << endl;
+    Table codec_table;
+    codec_table.add_row({"format", "original", "compressed", "ratio", "round trip"});
+    codec_table.add_row({"HUF1", to_string(text.size()), to_string(packed.size()),
+                         to_string(static_cast<double>(packed.size()) / text.size()), ok ? "ok" : "failed"});
+    codec_table.add_row({"HUFP", to_string(text.size()), to_string(ppacked.size()),
+                         to_string(static_cast<double>(ppacked.size()) / text.size()), pok ? "ok" : "failed"});
+    codec_table.add_row({"HUF1 corrupt header", to_string(corrupt.size()), "-", "-", rejected ? "rejected" : "failed"});
+    codec_table.add_row({"HUFP corrupt header", to_string(pcorrupt.size()), "-", "-", prejected ? "rejected" : "failed"});
+    codec_table.add_row({"HUF1 file", to_string(text.size()), to_string(fsize),
+                         to_string(static_cast<double>(fsize) / text.size()), fok ? "ok" : "failed"});
+    codec_table.add_row({"HUFP file", to_string(text.size()), to_string(pfsize),
+                         to_string(static_cast<double>(pfsize) / text.size()), pfok ? "ok" : "failed"});
+    codec_table.add_row({"HUFP file corrupt header", to_string(pcorrupt.size()), "-", "-", pfrejected ? "rejected" : "failed"});
+    codec_table.add_row({"adaptive", to_string(text.size()), to_string(apacked.size()),
+                         to_string(static_cast<double>(apacked.size()) / text.size()), aok ? "ok" : "failed"});
+    codec_table[0].format().font_color(Color::yellow); // 表头颜色
+    for (int i = 1; i <= 8; i++)
+    {
+        codec_table[i].format().font_color(Color::cyan); // 内容颜色
+    }
+    cout << codec_table << endl;
+
     // 释放内存
     for (int i = 0; i < n; i++)
     {
@@ -0,0 +1,38 @@
+#ifndef PACKED_THR_TREE_H
+#define PACKED_THR_TREE_H
+
+#include "threaded_binary_tree.h"
+#include <cstdint>
+
+#define THR_TAG_BIT 0x80000000u    // 最高位为线索标志，对应LTag/RTag为1
+#define THR_INDEX_MASK 0x7fffffffu // 低31位为结点在数组中的下标
+
+/**
+ * @brief 紧凑线索二叉树结点
+ * @param lchild 左孩子或前驱的下标，最高位为LTag
+ * @param rchild 右孩子或后继的下标，最高位为RTag
+ * @param data 数据
+ *
+ * 两个32位下标加一个字符共12字节，BiThrNode为32字节。
+ */
+struct PackedThrNode
+{
+    uint32_t lchild, rchild;
+    TElemType data;
+};
+
+/**
+ * @brief 以数组存放的紧凑中序线索二叉树
+ * @param nodes 结点数组，nodes[0]为头结点，其余结点按中序依次存放
+ */
+struct PackedThrTree
+{
+    std::vector<PackedThrNode> nodes;
+};
+
+Status PackThrTree(BiThrTree Thrt, PackedThrTree &P);
+uint32_t PackedFirst(const PackedThrTree &P);
+uint32_t PackedNext(const PackedThrTree &P, uint32_t i);
+uint32_t PackedPrior(const PackedThrTree &P, uint32_t i);
+
+#endif // PACKED_THR_TREE_H
@@ -3,6 +3,8 @@
 
 #include <vector>
 #include <string>
+#include <iterator>
+#include <cstddef>
 
 typedef int Status; // 声明函数类型名
 
@@ -22,6 +24,70 @@ void InitBiThrTree(BiThrTree &T, const std::vector<std::string> &preorder, const
 void InOrderThreading(BiThrTree &Thrt, BiThrTree T);
 void InOrderTraverse(BiThrTree T);
 void InOrderTraverse_Thr(BiThrTree T);
+BiThrTree InOrderFirst(BiThrTree Thrt);
+BiThrTree InOrderLast(BiThrTree Thrt);
+BiThrTree InOrderNext(BiThrTree p);
+BiThrTree InOrderPrior(BiThrTree p);
+BiThrTree InOrderLowerBound(BiThrTree Thrt, TElemType key);
+void InsertThrLeft(BiThrTree Thrt, BiThrTree p, BiThrTree s);
+void InsertThrRight(BiThrTree Thrt, BiThrTree p, BiThrTree s);
+Status InsertBSTThr(BiThrTree Thrt, TElemType key);
+Status DeleteBSTThr(BiThrTree Thrt, TElemType key);
 void generateDotAndPng(BiThrTree root, const std::string &dotFilename, const std::string &pngFilename);
+void generateSvg(BiThrTree root, std::string &svg);
+void generateSvgFile(BiThrTree root, const std::string &svgFilename);
+void generateSvgBatch(const std::vector<BiThrTree> &roots, std::vector<std::string> &svgs);
+
+/**
+ * @brief 中序线索二叉树的双向迭代器
+ *
+ * 沿LTag/RTag线索求后继和前驱，不使用栈，也不分配内存；
+ * 头结点作为尾后位置，对其自减得到中序最后一个结点。
+ */
+class BiThrIterator
+{
+public:
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef TElemType value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef TElemType *pointer;
+    typedef TElemType &reference;
+
+    explicit BiThrIterator(BiThrTree p = nullptr) : p(p) {}
+    reference operator*() const { return p->data; }
+    pointer operator->() const { return &p->data; }
+    BiThrTree node() const { return p; }
+    BiThrIterator &operator++()
+    {
+        p = InOrderNext(p);
+        return *this;
+    }
+    BiThrIterator operator++(int)
+    {
+        BiThrIterator t = *this;
+        p = InOrderNext(p);
+        return t;
+    }
+    BiThrIterator &operator--()
+    {
+        p = InOrderPrior(p);
+        return *this;
+    }
+    BiThrIterator operator--(int)
+    {
+        BiThrIterator t = *this;
+        p = InOrderPrior(p);
+        return t;
+    }
+    bool operator==(const BiThrIterator &o) const { return p == o.p; }
+    bool operator!=(const BiThrIterator &o) const { return p != o.p; }
+
+private:
+    BiThrTree p;
+};
+
+inline BiThrIterator ThrBegin(BiThrTree Thrt) { return BiThrIterator(InOrderFirst(Thrt)); }
+inline BiThrIterator ThrEnd(BiThrTree Thrt) { return BiThrIterator(Thrt); }
+inline BiThrIterator ThrLowerBound(BiThrTree Thrt, TElemType key) { return BiThrIterator(InOrderLowerBound(Thrt, key)); }
 
 #endif // THREADED_BINARY_TREE_H
\ No newline at end of file
@@ -0,0 +1,98 @@
+#include "threaded_binary_tree.h"
+#include "packed_thr_tree.h"
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+
+/**
+ * 以半开区间[lo, hi)中的整数为结点构建平衡二叉树，共hi - lo个结点，并按buildTree的约定设置LTag/RTag
+ * @param lo 区间起点（含）
+ * @param hi 区间终点（不含），lo >= hi时为空树
+ * @return 二叉树根节点
+ */
+static BiThrTree buildBalanced(long long lo, long long hi)
+{
+    if (lo >= hi)
+        return nullptr;
+    long long mid = lo + (hi - lo) / 2;
+    BiThrTree node = new BiThrNode(static_cast<TElemType>(mid & 0x7f));
+    node->lchild = buildBalanced(lo, mid);
+    node->rchild = buildBalanced(mid + 1, hi);
+    node->LTag = (node->lchild == nullptr) ? 1 : 0;
+    node->RTag = (node->rchild == nullptr) ? 1 : 0;
+    return node;
+}
+
+/**
+ * 与InOrderTraverse相同的递归方式遍历，只累加数据不输出
+ * @param T 线索二叉树根节点
+ * @param sum 累加结果
+ */
+static void recursiveInOrder(BiThrTree T, long long &sum)
+{
+    if (T)
+    {
+        if (T->LTag == 0)
+            recursiveInOrder(T->lchild, sum);
+        sum += T->data;
+        if (T->RTag == 0)
+            recursiveInOrder(T->rchild, sum);
+    }
+}
+
+template <class F>
+static double timeIt(F f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main(int argc, char *argv[])
+{
+    long long n = argc > 1 ? std::atoll(argv[1]) : (1LL << 22);
+    int rounds = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    BiThrTree root = buildBalanced(0, n);
+    BiThrTree Thrt;
+    InOrderThreading(Thrt, root);
+
+    PackedThrTree P;
+    if (PackThrTree(Thrt, P) != 1)
+    {
+        std::cerr << "结点数超出紧凑表示的31位下标" << std::endl;
+        return 1;
+    }
+
+    std::cout << "结点数: " << n << ", 轮数: " << rounds << std::endl;
+    std::cout << "结点大小: BiThrNode " << sizeof(BiThrNode) << " 字节, PackedThrNode " << sizeof(PackedThrNode) << " 字节" << std::endl;
+    long long s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0;
+    double tRec = 0, tFwd = 0, tBwd = 0, tPFwd = 0, tPBwd = 0;
+    for (int r = 0; r < rounds; ++r)
+    {
+        tRec += timeIt([&]()
+                       { recursiveInOrder(root, s1); });
+        tFwd += timeIt([&]()
+                       { for (BiThrIterator it = ThrBegin(Thrt); it != ThrEnd(Thrt); ++it) s2 += *it; });
+        tBwd += timeIt([&]()
+                       { BiThrIterator first = ThrBegin(Thrt);
+                         for (BiThrIterator it = ThrEnd(Thrt); it != first;) s3 += *--it; });
+        tPFwd += timeIt([&]()
+                        { for (uint32_t i = PackedFirst(P); i != 0; i = PackedNext(P, i)) s4 += P.nodes[i].data; });
+        tPBwd += timeIt([&]()
+                        { for (uint32_t i = PackedPrior(P, 0); i != 0; i = PackedPrior(P, i)) s5 += P.nodes[i].data; });
+    }
+    double per = 1e6 / (static_cast<double>(n) * rounds);
+    std::cout << "递归中序遍历:     " << tRec / rounds << " ms/轮, " << tRec * per << " ns/结点" << std::endl;
+    std::cout << "迭代器正向遍历:   " << tFwd / rounds << " ms/轮, " << tFwd * per << " ns/结点" << std::endl;
+    std::cout << "迭代器反向遍历:   " << tBwd / rounds << " ms/轮, " << tBwd * per << " ns/结点" << std::endl;
+    std::cout << "紧凑结点正向遍历: " << tPFwd / rounds << " ms/轮, " << tPFwd * per << " ns/结点" << std::endl;
+    std::cout << "紧凑结点反向遍历: " << tPBwd / rounds << " ms/轮, " << tPBwd * per << " ns/结点" << std::endl;
+    if (s1 != s2 || s1 != s3 || s1 != s4 || s1 != s5)
+    {
+        std::cout << "校验失败: " << s1 << " " << s2 << " " << s3 << " " << s4 << " " << s5 << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "threaded_binary_tree.h"
+#include "packed_thr_tree.h"
 #include <iostream>
 #include <vector>
 #include <string>
@@ -23,11 +24,10 @@ int main()
     InitBiThrTree(root, preorder, "#");
 
     // 生成二叉树的图像
-    std::string dotFilename = "binary_tree.dot";
-    std::string pngFilename = "binary_tree.png";
-    generateDotAndPng(root, dotFilename, pngFilename);
+    std::string svgFilename = "binary_tree.svg";
+    generateSvgFile(root, svgFilename);
 
-    std::cout << "二叉树的图像已生成：" << pngFilename << std::endl;
+    std::cout << "二叉树的图像已生成：" << svgFilename << std::endl;
     std::cout << "中序遍历尚未线索化的二叉树：" << std::endl;
     // 中序遍历二叉树
     InOrderTraverse(root);
@@ -44,5 +44,41 @@ int main()
     // 按线索和孩子中序遍历线索二叉树
     InOrderTraverse_Thr(Thrt);
 
+    // 使用迭代器沿线索正向、反向遍历
+    std::cout << "迭代器正向中序序列：";
+    for (BiThrIterator it = ThrBegin(Thrt); it != ThrEnd(Thrt); ++it)
+        std::cout << *it << " ";
+    std::cout << std::endl;
+    std::cout << "迭代器反向中序序列：";
+    BiThrIterator first = ThrBegin(Thrt);
+    for (BiThrIterator it = ThrEnd(Thrt); it != first;)
+        std::cout << *--it << " ";
+    std::cout << std::endl;
+
+    // 在线索二叉搜索树上增量插入、删除，线索随之局部修正，无需重新线索化
+    BiThrTree BST;
+    InOrderThreading(BST, nullptr);
+    const char *keys = "DBFACEG";
+    for (int i = 0; keys[i] != '\0'; ++i)
+        InsertBSTThr(BST, keys[i]);
+    DeleteBSTThr(BST, 'B');
+    DeleteBSTThr(BST, 'G');
+    InsertBSTThr(BST, 'H');
+    std::cout << "插入DBFACEG、删除B和G、插入H后的中序序列：";
+    for (BiThrIterator it = ThrBegin(BST); it != ThrEnd(BST); ++it)
+        std::cout << *it << " ";
+    std::cout << std::endl;
+    // 转换为紧凑数组表示（32位下标，线索标志存放在下标最高位）
+    PackedThrTree P;
+    PackThrTree(BST, P);
+    std::cout << "紧凑表示的中序序列（" << sizeof(PackedThrNode) << " 字节/结点）：";
+    for (uint32_t i = PackedFirst(P); i != 0; i = PackedNext(P, i))
+        std::cout << P.nodes[i].data << " ";
+    std::cout << std::endl;
+    std::cout << "不小于E的结点：";
+    for (BiThrIterator it = ThrLowerBound(BST, 'E'); it != ThrEnd(BST); ++it)
+        std::cout << *it << " ";
+    std::cout << std::endl;
+
     return 0;
 }
\ No newline at end of file
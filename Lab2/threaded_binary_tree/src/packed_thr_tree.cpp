@@ -0,0 +1,127 @@
+#include "packed_thr_tree.h"
+#include <vector>
+
+/**
+ * 将中序线索二叉树转换为紧凑数组表示
+ * @param Thrt 线索二叉树头结点
+ * @param P 转换结果
+ * @return 成功返回1；结点数达到2^31、超出31位下标时返回-1，P为空
+ *
+ * 算法实现:
+ * 1. 先沿线索中序遍历一次求结点数，超出31位下标时拒绝，否则一次分配好数组。
+ * 2. 再按中序逐个为结点分配下标，头结点下标为0，不需要指针到下标的映射：
+ *    左线索指向中序前驱，即下标k-1；右线索指向中序后继，即下标k+1，最后一个结点为0。
+ * 3. 孩子指针用一个深度为树高的栈回填：右孩子在双亲之后编号，入栈时记下双亲中待写的位置；
+ *    左孩子在双亲之前编号，编号后直接写入仍在栈中的双亲的栈帧。
+ * 4. 结点按中序连续存放，沿后继线索遍历时基本是顺序访问数组，每个缓存行可容纳的结点数约为原来的2.7倍。
+ */
+Status PackThrTree(BiThrTree Thrt, PackedThrTree &P)
+{
+    P.nodes.clear();
+    uint64_t count = 1;
+    for (BiThrTree p = InOrderFirst(Thrt); p != Thrt; p = InOrderNext(p))
+        if (++count > static_cast<uint64_t>(THR_INDEX_MASK) + 1)
+            return -1;
+    uint32_t n = static_cast<uint32_t>(count);
+
+    P.nodes.resize(n);
+    P.nodes[0].data = Thrt->data;
+    P.nodes[0].lchild = 0;
+    P.nodes[0].rchild = (n - 1) | THR_TAG_BIT;
+
+    struct Frame
+    {
+        BiThrTree node;
+        uint32_t *slot; // 结点编号后写入的位置；为空表示它是下一栈帧的左孩子
+        uint32_t left;  // 左孩子的下标
+    };
+    std::vector<Frame> stack;
+    auto descend = [&](BiThrTree p, uint32_t *slot)
+    {
+        for (;; p = p->lchild, slot = nullptr)
+        {
+            stack.push_back({p, slot, 0});
+            if (p->LTag)
+                break;
+        }
+    };
+    if (Thrt->lchild != Thrt)
+        descend(Thrt->lchild, &P.nodes[0].lchild);
+
+    for (uint32_t k = 1; !stack.empty(); k++)
+    {
+        Frame f = stack.back();
+        stack.pop_back();
+        if (f.slot)
+            *f.slot = k;
+        else
+            stack.back().left = k;
+
+        BiThrTree p = f.node;
+        PackedThrNode &node = P.nodes[k];
+        node.data = p->data;
+        node.lchild = p->LTag ? (k - 1) | THR_TAG_BIT : f.left;
+        node.rchild = p->RTag ? (k + 1 == n ? 0 : k + 1) | THR_TAG_BIT : 0;
+        if (!p->RTag)
+            descend(p->rchild, &node.rchild);
+    }
+    return 1;
+}
+
+/**
+ * 求紧凑线索二叉树的中序第一个结点
+ * @param P 紧凑线索二叉树
+ * @return 中序第一个结点的下标，树空时返回0（头结点）
+ *
+ * 算法实现:
+ * 1. 从根结点出发沿左孩子一直向下，直到遇到左线索。
+ */
+uint32_t PackedFirst(const PackedThrTree &P)
+{
+    uint32_t i = P.nodes[0].lchild & THR_INDEX_MASK;
+    if (i == 0)
+        return 0;
+    while (!(P.nodes[i].lchild & THR_TAG_BIT))
+        i = P.nodes[i].lchild;
+    return i;
+}
+
+/**
+ * 求紧凑线索二叉树中结点的中序后继
+ * @param P 紧凑线索二叉树
+ * @param i 当前结点下标
+ * @return 中序后继的下标，i为最后一个结点时返回0
+ *
+ * 算法实现:
+ * 1. 若RTag为1，右线索即为后继。
+ * 2. 否则后继为右子树的最左下结点。
+ */
+uint32_t PackedNext(const PackedThrTree &P, uint32_t i)
+{
+    uint32_t r = P.nodes[i].rchild;
+    if (r & THR_TAG_BIT)
+        return r & THR_INDEX_MASK;
+    while (!(P.nodes[r].lchild & THR_TAG_BIT))
+        r = P.nodes[r].lchild;
+    return r;
+}
+
+/**
+ * 求紧凑线索二叉树中结点的中序前驱
+ * @param P 紧凑线索二叉树
+ * @param i 当前结点下标
+ * @return 中序前驱的下标，i为第一个结点时返回0；i为0时返回最后一个结点
+ *
+ * 算法实现:
+ * 1. 若LTag为1，左线索即为前驱。
+ * 2. 否则前驱为左子树的最右下结点。
+ */
+uint32_t PackedPrior(const PackedThrTree &P, uint32_t i)
+{
+    uint32_t l = P.nodes[i].lchild;
+    if (l & THR_TAG_BIT)
+        return l & THR_INDEX_MASK;
+    while (!(P.nodes[l].rchild & THR_TAG_BIT))
+        l = P.nodes[l].rchild;
+    return l;
+}
@@ -1,4 +1,5 @@
 #include "threaded_binary_tree.h"
+#include "tree_svg.h"
 #include <iostream>
 #include <fstream>
 #include <functional>
@@ -162,6 +163,339 @@ void InOrderTraverse_Thr(BiThrTree T)
     std::cout << table << std::endl;
 }
 
+/**
+ * 求中序线索二叉树的第一个结点
+ * @param Thrt 线索二叉树头结点
+ * @return 中序第一个结点，树空时返回头结点
+ *
+ * 算法实现:
+ * 1. 从根结点出发沿左孩子（LTag为0）一直向下，最左下结点即为所求。
+ */
+BiThrTree InOrderFirst(BiThrTree Thrt)
+{
+    BiThrTree p = Thrt->lchild;
+    if (p == Thrt)
+        return Thrt;
+    while (p->LTag == 0)
+        p = p->lchild;
+    return p;
+}
+
+/**
+ * 求中序线索二叉树的最后一个结点
+ * @param Thrt 线索二叉树头结点
+ * @return 中序最后一个结点，树空时返回头结点
+ *
+ * 算法实现:
+ * 1. 头结点的右线索指向中序最后一个结点，直接返回。
+ */
+BiThrTree InOrderLast(BiThrTree Thrt)
+{
+    return Thrt->rchild;
+}
+
+/**
+ * 求结点的中序后继
+ * @param p 当前结点
+ * @return 中序后继，p为最后一个结点时返回头结点
+ *
+ * 算法实现:
+ * 1. 若RTag为1，右线索即为后继。
+ * 2. 否则后继为右子树的最左下结点。
+ * 3. 每条边在一次完整遍历中至多经过两次，均摊O(1)。
+ */
+BiThrTree InOrderNext(BiThrTree p)
+{
+    if (p->RTag == 1)
+        return p->rchild;
+    BiThrTree q = p->rchild;
+    while (q->LTag == 0)
+        q = q->lchild;
+    return q;
+}
+
+/**
+ * 求结点的中序前驱
+ * @param p 当前结点
+ * @return 中序前驱，p为第一个结点时返回头结点；p为头结点时返回最后一个结点
+ *
+ * 算法实现:
+ * 1. 若LTag为1，左线索即为前驱。
+ * 2. 否则前驱为左子树的最右下结点。
+ */
+BiThrTree InOrderPrior(BiThrTree p)
+{
+    if (p->LTag == 1)
+        return p->lchild;
+    BiThrTree q = p->lchild;
+    while (q->RTag == 0)
+        q = q->rchild;
+    return q;
+}
+
+/**
+ * 在按关键字有序的中序线索二叉树（二叉搜索树）中查找第一个不小于key的结点
+ * @param Thrt 线索二叉树头结点
+ * @param key 查找的关键字
+ * @return 第一个不小于key的结点，不存在时返回头结点
+ *
+ * 算法实现:
+ * 1. 从根结点出发，若当前结点不小于key则记为候选并沿左孩子下行，否则沿右孩子下行。
+ * 2. 遇到线索（标志为1）即停止，代价为O(树高)。
+ * 3. 结合InOrderNext即可从下界开始做区间扫描。
+ */
+BiThrTree InOrderLowerBound(BiThrTree Thrt, TElemType key)
+{
+    BiThrTree candidate = Thrt;
+    BiThrTree p = Thrt->lchild;
+    if (p == Thrt)
+        return Thrt;
+    while (true)
+    {
+        if (!(p->data < key))
+        {
+            candidate = p;
+            if (p->LTag == 1)
+                break;
+            p = p->lchild;
+        }
+        else
+        {
+            if (p->RTag == 1)
+                break;
+            p = p->rchild;
+        }
+    }
+    return candidate;
+}
+
+/**
+ * 将结点s插入为结点p的左孩子，并局部修正线索
+ * @param Thrt 线索二叉树头结点
+ * @param p 插入位置的双亲结点
+ * @param s 待插入的新结点
+ *
+ * 算法实现:
+ * 1. p原来的左子树（或左线索）交给s，s的右线索指向p（s成为p的中序前驱）。
+ * 2. p的左孩子改为s。
+ * 3. 若s接管了p的左子树，该子树最右下结点的右线索原来指向p，改为指向s。
+ * 4. 只修改常数个指针，接管子树时需O(树高)查找其最右下结点。
+ */
+void InsertThrLeft(BiThrTree Thrt, BiThrTree p, BiThrTree s)
+{
+    (void)Thrt;
+    s->lchild = p->lchild;
+    s->LTag = p->LTag;
+    s->rchild = p;
+    s->RTag = 1;
+    p->lchild = s;
+    p->LTag = 0;
+    if (s->LTag == 0)
+    {
+        BiThrTree q = s->lchild;
+        while (q->RTag == 0)
+            q = q->rchild;
+        q->rchild = s;
+    }
+}
+
+/**
+ * 将结点s插入为结点p的右孩子，并局部修正线索
+ * @param Thrt 线索二叉树头结点
+ * @param p 插入位置的双亲结点
+ * @param s 待插入的新结点
+ *
+ * 算法实现:
+ * 1. p原来的右子树（或右线索）交给s，s的左线索指向p（s成为p的中序后继）。
+ * 2. p的右孩子改为s。
+ * 3. 若s接管了p的右子树，该子树最左下结点的左线索原来指向p，改为指向s。
+ * 4. 若s成为中序最后一个结点，更新头结点的右线索。
+ */
+void InsertThrRight(BiThrTree Thrt, BiThrTree p, BiThrTree s)
+{
+    s->rchild = p->rchild;
+    s->RTag = p->RTag;
+    s->lchild = p;
+    s->LTag = 1;
+    p->rchild = s;
+    p->RTag = 0;
+    if (s->RTag == 0)
+    {
+        BiThrTree q = s->rchild;
+        while (q->LTag == 0)
+            q = q->lchild;
+        q->lchild = s;
+    }
+    else if (s->rchild == Thrt)
+    {
+        Thrt->rchild = s;
+    }
+}
+
+/**
+ * 在按关键字有序的中序线索二叉树中插入关键字
+ * @param Thrt 线索二叉树头结点
+ * @param key 插入的关键字
+ * @return 插入成功返回1，关键字已存在返回0
+ *
+ * 算法实现:
+ * 1. 树空时新结点作为根，左右线索都指向头结点。
+ * 2. 否则沿孩子指针查找插入位置，遇到线索即停止，新结点作为叶子由InsertThrLeft或InsertThrRight挂接。
+ * 3. 只修正新结点及其双亲的线索，代价为O(树高)，无需重新调用InOrderThreading。
+ */
+Status InsertBSTThr(BiThrTree Thrt, TElemType key)
+{
+    BiThrTree s = new BiThrNode(key);
+    if (Thrt->lchild == Thrt)
+    {
+        s->LTag = s->RTag = 1;
+        s->lchild = s->rchild = Thrt;
+        Thrt->lchild = s;
+        Thrt->rchild = s;
+        return 1;
+    }
+    BiThrTree p = Thrt->lchild;
+    while (true)
+    {
+        if (key == p->data)
+        {
+            delete s;
+            return 0;
+        }
+        if (key < p->data)
+        {
+            if (p->LTag == 1)
+            {
+                InsertThrLeft(Thrt, p, s);
+                return 1;
+            }
+            p = p->lchild;
+        }
+        else
+        {
+            if (p->RTag == 1)
+            {
+                InsertThrRight(Thrt, p, s);
+                return 1;
+            }
+            p = p->rchild;
+        }
+    }
+}
+
+/**
+ * 删除至多有一个孩子的结点，并局部修正线索
+ * @param Thrt 线索二叉树头结点
+ * @param par p的双亲（p为根时为头结点）
+ * @param p 待删除的结点
+ *
+ * 算法实现:
+ * 1. p为叶子：双亲指向p的孩子指针改为线索，左孩子继承p的前驱线索，右孩子继承p的后继线索。
+ * 2. p只有左子树：左子树接到双亲上，左子树最右下结点（p的前驱）的右线索改为p的后继。
+ * 3. p只有右子树：右子树接到双亲上，右子树最左下结点（p的后继）的左线索改为p的前驱。
+ * 4. 若p是中序最后一个结点，头结点的右线索改为p的前驱；树删空时恢复为空树的头结点。
+ */
+static void deleteThrNode(BiThrTree Thrt, BiThrTree par, BiThrTree p)
+{
+    bool isLeft = (par == Thrt) || (par->LTag == 0 && par->lchild == p);
+    if (p->LTag == 1 && p->RTag == 1)
+    {
+        if (par == Thrt)
+        {
+            Thrt->lchild = Thrt;
+            Thrt->rchild = Thrt;
+        }
+        else if (isLeft)
+        {
+            par->LTag = 1;
+            par->lchild = p->lchild;
+        }
+        else
+        {
+            par->RTag = 1;
+            par->rchild = p->rchild;
+        }
+        if (Thrt->rchild == p)
+            Thrt->rchild = p->lchild;
+    }
+    else
+    {
+        BiThrTree child;
+        if (p->LTag == 0)
+        {
+            child = p->lchild;
+            BiThrTree q = child;
+            while (q->RTag == 0)
+                q = q->rchild;
+            q->rchild = p->rchild;
+            if (Thrt->rchild == p)
+                Thrt->rchild = q;
+        }
+        else
+        {
+            child = p->rchild;
+            BiThrTree q = child;
+            while (q->LTag == 0)
+                q = q->lchild;
+            q->lchild = p->lchild;
+        }
+        if (isLeft)
+            par->lchild = child;
+        else
+            par->rchild = child;
+    }
+    delete p;
+}
+
+/**
+ * 在按关键字有序的中序线索二叉树中删除关键字
+ * @param Thrt 线索二叉树头结点
+ * @param key 删除的关键字
+ * @return 删除成功返回1，关键字不存在返回0
+ *
+ * 算法实现:
+ * 1. 沿孩子指针查找关键字所在结点p及其双亲。
+ * 2. 若p有两个孩子，找到其中序后继s（右子树最左下结点，至多有右孩子），用s的数据替换p的数据，转为删除s。
+ * 3. 调用deleteThrNode删除至多有一个孩子的结点，只修正受影响的常数条线索，代价为O(树高)。
+ */
+Status DeleteBSTThr(BiThrTree Thrt, TElemType key)
+{
+    if (Thrt->lchild == Thrt)
+        return 0;
+    BiThrTree par = Thrt, p = Thrt->lchild;
+    while (p->data != key)
+    {
+        if (key < p->data)
+        {
+            if (p->LTag == 1)
+                return 0;
+            par = p;
+            p = p->lchild;
+        }
+        else
+        {
+            if (p->RTag == 1)
+                return 0;
+            par = p;
+            p = p->rchild;
+        }
+    }
+    if (p->LTag == 0 && p->RTag == 0)
+    {
+        BiThrTree sp = p, s = p->rchild;
+        while (s->LTag == 0)
+        {
+            sp = s;
+            s = s->lchild;
+        }
+        p->data = s->data;
+        par = sp;
+        p = s;
+    }
+    deleteThrNode(Thrt, par, p);
+    return 1;
+}
+
 /**
  * 生成dot文件
  * @param node 当前节点
@@ -227,4 +561,94 @@ void generateDotAndPng(BiThrTree root, const std::string &dotFilename, const std
 
     std::string command = "dot -Tpng " + dotFilename + " -o " + pngFilename;
     system(command.c_str());
-}
\ No newline at end of file
+}
+
+/**
+ * 将线索二叉树按先序扁平化（非递归）
+ * @param root 线索二叉树根节点（也可以是头结点）
+ * @param t 扁平化结果
+ *
+ * 算法实现:
+ * 1. 使用显式栈按先序访问结点，只沿标志为0的孩子指针下行，线索不作为边。
+ * 2. 每出栈一个结点分配下标，并回填到双亲的lchild或rchild。
+ */
+static void flattenTree(BiThrTree root, SvgTree &t)
+{
+    t.clear();
+    if (!root)
+        return;
+    struct Item
+    {
+        BiThrTree node;
+        int parent;
+        bool right;
+    };
+    std::vector<Item> s;
+    s.push_back({root, -1, false});
+    while (!s.empty())
+    {
+        Item it = s.back();
+        s.pop_back();
+        int id = t.addNode(it.node->data);
+        if (it.parent >= 0)
+            (it.right ? t.rchild : t.lchild)[it.parent] = id;
+        if (it.node->RTag == 0 && it.node->rchild)
+            s.push_back({it.node->rchild, id, true});
+        if (it.node->LTag == 0 && it.node->lchild)
+            s.push_back({it.node->lchild, id, false});
+    }
+}
+
+/**
+ * 在进程内生成线索二叉树的SVG图像
+ * @param root 线索二叉树根节点
+ * @param svg SVG文本输出缓冲区
+ *
+ * 算法实现:
+ * 1. 非递归扁平化二叉树。
+ * 2. 调用RenderTreeSvg按Reingold–Tilford布局直接生成SVG文本，不依赖外部dot程序。
+ */
+void generateSvg(BiThrTree root, std::string &svg)
+{
+    SvgTree t;
+    flattenTree(root, t);
+    svg.clear();
+    RenderTreeSvg(t, svg);
+}
+
+/**
+ * 生成线索二叉树的SVG文件
+ * @param root 线索二叉树根节点
+ * @param svgFilename SVG文件名
+ *
+ * 算法实现:
+ * 1. 调用generateSvg生成SVG文本。
+ * 2. 一次性写入文件。
+ */
+void generateSvgFile(BiThrTree root, const std::string &svgFilename)
+{
+    std::string svg;
+    generateSvg(root, svg);
+    std::ofstream ofs(svgFilename, std::ios::binary);
+    ofs.write(svg.data(), static_cast<std::streamsize>(svg.size()));
+}
+
+/**
+ * 批量生成多棵线索二叉树的SVG图像
+ * @param roots 线索二叉树根节点数组
+ * @param svgs 输出的SVG文本数组，与roots一一对应
+ *
+ * 算法实现:
+ * 1. 复用同一个扁平化缓冲区，依次扁平化并渲染每棵树，避免逐棵重新分配。
+ */
+void generateSvgBatch(const std::vector<BiThrTree> &roots, std::vector<std::string> &svgs)
+{
+    SvgTree t;
+    svgs.resize(roots.size());
+    for (size_t i = 0; i < roots.size(); ++i)
+    {
+        flattenTree(roots[i], t);
+        svgs[i].clear();
+        RenderTreeSvg(t, svgs[i]);
+    }
+}
@@ -0,0 +1,117 @@
+// CSRGraph.h
+#ifndef CSRGRAPH_H
+#define CSRGRAPH_H
+
+#include <cstdint>
+#include <vector>
+
+#define CSR_NO_VERTEX 0xffffffffu      // 表示不存在的顶点
+#define CSR_NO_PATH 0x7fffffffffffffffll // 表示不可达的距离
+
+typedef int Status;
+
+typedef enum
+{
+    DG,
+    DN,
+    UDG,
+    UDN
+} GraphKind; // 图的枚举类型
+
+typedef uint32_t VertexId; // 顶点编号，32位
+typedef uint64_t EdgeId;   // 弧在CSR数组中的下标，边数可超过2^32
+typedef int VRType;        // 权值类型
+typedef char VertexType;
+
+// 压缩稀疏行（CSR）存储的图
+// 顶点v的出弧为adj[offset[v]] ... adj[offset[v + 1] - 1]，权值存放在与adj对齐的weight中；
+// 无向图的每条边在两端各存一次
+typedef struct
+{
+    GraphKind kind;
+    VertexId vexnum;              // 顶点数
+    EdgeId arcnum;                // 输入的弧（边）数
+    std::vector<EdgeId> offset;   // 各顶点出弧的起点，共vexnum + 1项
+    std::vector<VertexId> adj;    // 出弧的终点
+    std::vector<VRType> weight;   // 出弧的权值，无权图为空
+    std::vector<EdgeId> inOffset; // 入弧的起点，调用BuildCSRReverse后有效（仅有向图）
+    std::vector<VertexId> inAdj;  // 入弧的起点顶点
+    std::vector<VRType> inWeight; // 入弧的权值
+    std::vector<VertexType> vexs; // 顶点名称，可为空
+} CSRGraph;
+
+// 生成树或关键路径中的一条弧
+typedef struct
+{
+    VertexId from, to;
+    VRType weight;
+} CSRArc;
+
+// 广度优先搜索的结果：未到达的顶点parent与level均为CSR_NO_VERTEX
+typedef struct
+{
+    std::vector<VertexId> parent; // BFS树中的双亲，源点的双亲是自身
+    std::vector<VertexId> level;  // 到源点的层数（边数）
+    VertexId reached;             // 到达的顶点数
+} CSRBFSResult;
+
+// 单源最短路径的结果：不可达的顶点dist为CSR_NO_PATH，pred为CSR_NO_VERTEX
+typedef struct
+{
+    std::vector<long long> dist; // 到源点的最短路径长度
+    std::vector<VertexId> pred;  // 最短路径树中的前驱，源点的前驱是自身
+} CSRShortestPathResult;
+
+// 关键路径的计算结果
+typedef struct
+{
+    std::vector<long long> ve;    // 事件最早发生时间
+    std::vector<long long> vl;    // 事件最迟发生时间
+    std::vector<VertexId> topo;   // 拓扑序列
+    std::vector<CSRArc> critical; // 关键活动
+    long long length;             // 工期
+} CSRCriticalPathResult;
+
+// 权值访问：无权图的每条弧权值为1
+inline VRType ArcWeight(const CSRGraph &G, EdgeId e)
+{
+    return G.weight.empty() ? 1 : G.weight[e];
+}
+
+inline bool IsDirected(const CSRGraph &G)
+{
+    return G.kind == DG || G.kind == DN;
+}
+
+// 构造与输出
+Status CreateCSRGraph(GraphKind GKind, CSRGraph &G, VertexId vexnum, EdgeId arcnum, const VertexType *vexs,
+                      const int *arcs, int threads = 0);
+Status CreateCSRGraph(GraphKind GKind, CSRGraph &G, VertexId vexnum, const std::vector<VertexId> &from,
+                      const std::vector<VertexId> &to, const std::vector<VRType> &w, int threads = 0);
+void BuildCSRReverse(CSRGraph &G, int threads = 0);
+void OutCSRGraph(const CSRGraph &G);
+void CSRVerDegree(const CSRGraph &G, std::vector<EdgeId> &inDegree, std::vector<EdgeId> &outDegree, int threads = 0);
+
+// 遍历
+void CSRDFSTraverse(const CSRGraph &G, std::vector<VertexId> &order);
+void CSRBFSTraverse(const CSRGraph &G, std::vector<VertexId> &order);
+void CSRParallelBFS(const CSRGraph &G, VertexId source, CSRBFSResult &result, int threads = 0);
+VertexId CSRConnectedComponents(const CSRGraph &G, std::vector<VertexId> &comp, int threads = 0);
+
+// 最小生成树（森林）
+long long CSRPrim(const CSRGraph &G, VertexId root, std::vector<CSRArc> &tree);
+long long CSRKruskal(const CSRGraph &G, std::vector<CSRArc> &tree);
+long long CSRFilterKruskal(const CSRGraph &G, std::vector<CSRArc> &tree, int threads = 0);
+long long CSRBoruvka(const CSRGraph &G, std::vector<CSRArc> &tree, int threads = 0);
+
+// 最短路径（权值须非负）
+Status CSRDijkstra(const CSRGraph &G, VertexId source, CSRShortestPathResult &result);
+Status CSRDeltaStepping(const CSRGraph &G, VertexId source, CSRShortestPathResult &result, long long delta = 0,
+                        int threads = 0);
+Status CSRMultiSourceShortestPaths(const CSRGraph &G, const std::vector<VertexId> &sources,
+                                   std::vector<CSRShortestPathResult> &results, int threads = 0);
+
+// 关键路径
+bool CSRCriticalPath(const CSRGraph &G, CSRCriticalPathResult &result);
+
+#endif // CSRGRAPH_H
@@ -0,0 +1,164 @@
+// CSRHeap.h
+#ifndef CSRHEAP_H
+#define CSRHEAP_H
+
+#include "CSRGraph.h"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// 以顶点为元素的D叉小顶堆，支持按顶点减小关键字（decrease-key）
+// pos记录每个顶点在堆数组中的位置，不在堆中为CSR_NO_VERTEX；
+// D = 4时树高只有二叉堆的一半，一个结点的孩子落在同一条缓存行中
+template <typename Key, int D = 4>
+class IndexedHeap
+{
+private:
+    std::vector<VertexId> heap; // 堆数组，存放顶点
+    std::vector<VertexId> pos;  // 各顶点在堆数组中的下标
+    std::vector<Key> keys;      // 各顶点的关键字
+
+    void place(VertexId v, std::size_t i)
+    {
+        heap[i] = v;
+        pos[v] = static_cast<VertexId>(i);
+    }
+
+    // 从下标i向上调整
+    void siftUp(std::size_t i)
+    {
+        VertexId v = heap[i];
+        while (i > 0)
+        {
+            std::size_t p = (i - 1) / D;
+            if (!(keys[v] < keys[heap[p]]))
+                break;
+            place(heap[p], i);
+            i = p;
+        }
+        place(v, i);
+    }
+
+    // 从下标i向下调整：在至多D个孩子中找最小者
+    void siftDown(std::size_t i)
+    {
+        VertexId v = heap[i];
+        std::size_t n = heap.size();
+        for (;;)
+        {
+            std::size_t c = i * D + 1;
+            if (c >= n)
+                break;
+            std::size_t best = c, end = c + D < n ? c + D : n;
+            for (std::size_t k = c + 1; k < end; k++)
+                if (keys[heap[k]] < keys[heap[best]])
+                    best = k;
+            if (!(keys[heap[best]] < keys[v]))
+                break;
+            place(heap[best], i);
+            i = best;
+        }
+        place(v, i);
+    }
+
+public:
+    explicit IndexedHeap(VertexId n) : pos(n, CSR_NO_VERTEX), keys(n) {}
+
+    bool empty() const { return heap.empty(); }
+    std::size_t size() const { return heap.size(); }
+    bool contains(VertexId v) const { return pos[v] != CSR_NO_VERTEX; }
+    Key key(VertexId v) const { return keys[v]; }
+
+    // 插入顶点v；v已在堆中时，k更小才减小其关键字。返回是否有改动
+    bool pushOrDecrease(VertexId v, Key k)
+    {
+        if (!contains(v))
+        {
+            keys[v] = k;
+            heap.push_back(v);
+            siftUp(heap.size() - 1);
+            return true;
+        }
+        if (!(k < keys[v]))
+            return false;
+        keys[v] = k;
+        siftUp(pos[v]);
+        return true;
+    }
+
+    // 弹出关键字最小的顶点
+    VertexId pop()
+    {
+        VertexId top = heap[0];
+        pos[top] = CSR_NO_VERTEX;
+        VertexId last = heap.back();
+        heap.pop_back();
+        if (!heap.empty())
+        {
+            heap[0] = last;
+            siftDown(0);
+        }
+        return top;
+    }
+};
+
+// 基数堆：关键字为非负整数，且弹出的关键字单调不减（Dijkstra满足这一点）
+// 关键字与上一次弹出的值last按最高的不同位分入65个桶，桶0中的元素关键字都等于last；
+// 桶0为空时取第一个非空桶中的最小关键字作为新的last，重新分桶，每个元素至多下移64次，
+// 均摊O(log C)，只用顺序读写的数组，没有比较堆的随机访问。不支持decrease-key，过期项由调用者跳过
+template <typename Value>
+class RadixHeap
+{
+private:
+    std::vector<std::pair<uint64_t, Value>> buckets[65];
+    uint64_t last;     // 上一次弹出的关键字
+    std::size_t count; // 元素个数
+
+    static int bucketOf(uint64_t key, uint64_t last)
+    {
+        return key == last ? 0 : 64 - __builtin_clzll(key ^ last);
+    }
+
+    // 桶0为空时，把第一个非空桶中的元素按新的last重新分桶
+    void refill()
+    {
+        int b = 1;
+        while (buckets[b].empty())
+            b++;
+        uint64_t low = buckets[b][0].first;
+        for (const auto &item : buckets[b])
+            if (item.first < low)
+                low = item.first;
+        last = low;
+        for (const auto &item : buckets[b])
+            buckets[bucketOf(item.first, last)].push_back(item);
+        buckets[b].clear();
+    }
+
+public:
+    RadixHeap() : last(0), count(0) {}
+
+    bool empty() const { return count == 0; }
+    std::size_t size() const { return count; }
+
+    // 插入元素，key不能小于上一次弹出的关键字
+    void push(uint64_t key, Value v)
+    {
+        buckets[bucketOf(key, last)].push_back(std::make_pair(key, v));
+        count++;
+    }
+
+    // 弹出关键字最小的元素
+    std::pair<uint64_t, Value> pop()
+    {
+        if (buckets[0].empty())
+            refill();
+        std::pair<uint64_t, Value> top = buckets[0].back();
+        buckets[0].pop_back();
+        count--;
+        return top;
+    }
+};
+
+#endif // CSRHEAP_H
@@ -0,0 +1,96 @@
+// CSRParallel.h
+#ifndef CSRPARALLEL_H
+#define CSRPARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// 线程数，0表示使用硬件并发数
+inline int CSRThreads(int threads)
+{
+    if (threads <= 0)
+        threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    return threads;
+}
+
+// 把[0, n)切成若干段，由threads个线程通过原子游标领取并调用fn(lo, hi)；调用线程自身也参与
+template <typename F>
+void ParallelFor(int threads, size_t n, F fn)
+{
+    threads = CSRThreads(threads);
+    if (n == 0)
+        return;
+    if (threads == 1)
+    {
+        fn(static_cast<size_t>(0), n);
+        return;
+    }
+    size_t grain = std::max<size_t>(1, n / (static_cast<size_t>(threads) * 16));
+    std::atomic<size_t> cursor(0);
+    auto worker = [&]()
+    {
+        for (size_t lo = cursor.fetch_add(grain); lo < n; lo = cursor.fetch_add(grain))
+            fn(lo, std::min(n, lo + grain));
+    };
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threads; t++)
+        pool.emplace_back(worker);
+    worker();
+    for (std::thread &th : pool)
+        th.join();
+}
+
+// 原位计算前缀和：a[i]变为a[0] + ... + a[i - 1]，a[0]为0（a的最后一项用于存放总和）
+template <typename T>
+void ParallelExclusiveScan(int threads, std::vector<T> &a)
+{
+    threads = CSRThreads(threads);
+    size_t n = a.size();
+    size_t parts = std::min<size_t>(static_cast<size_t>(threads), std::max<size_t>(1, n / 65536));
+    if (parts <= 1)
+    {
+        T sum = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            T x = a[i];
+            a[i] = sum;
+            sum += x;
+        }
+        return;
+    }
+    // 第一遍各段求和，第二遍各段加上前面各段的总和
+    std::vector<T> partSum(parts + 1, 0);
+    size_t len = (n + parts - 1) / parts;
+    std::vector<std::thread> pool;
+    for (size_t p = 0; p < parts; p++)
+        pool.emplace_back([&, p]()
+                          {
+            size_t lo = p * len, hi = std::min(n, lo + len);
+            T s = 0;
+            for (size_t i = lo; i < hi; i++)
+                s += a[i];
+            partSum[p + 1] = s; });
+    for (std::thread &th : pool)
+        th.join();
+    pool.clear();
+    for (size_t p = 1; p <= parts; p++)
+        partSum[p] += partSum[p - 1];
+    for (size_t p = 0; p < parts; p++)
+        pool.emplace_back([&, p]()
+                          {
+            size_t lo = p * len, hi = std::min(n, lo + len);
+            T sum = partSum[p];
+            for (size_t i = lo; i < hi; i++)
+            {
+                T x = a[i];
+                a[i] = sum;
+                sum += x;
+            } });
+    for (std::thread &th : pool)
+        th.join();
+}
+
+#endif // CSRPARALLEL_H
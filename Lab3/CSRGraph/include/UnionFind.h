@@ -0,0 +1,154 @@
+// UnionFind.h
+#ifndef UNIONFIND_H
+#define UNIONFIND_H
+
+#include "CSRGraph.h"
+#include "CSRParallel.h"
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// 并查集：双亲与集合大小都是32位数组，查找时路径减半，合并时按大小合并
+// 集合个数随合并增量维护，不需要扫描整个双亲数组
+class UnionFind
+{
+private:
+    std::vector<VertexId> parent; // 各元素的双亲，根的双亲是自己
+    std::vector<VertexId> size;   // 以该元素为根的集合大小，只对根有意义
+    VertexId sets;                // 当前的集合个数
+
+public:
+    explicit UnionFind(VertexId n) : parent(n), size(n, 1), sets(n)
+    {
+        for (VertexId v = 0; v < n; v++)
+            parent[v] = v;
+    }
+
+    // 查找x所在集合的根：把x的双亲改为祖父后跳到祖父，树高每次减半
+    VertexId find(VertexId x)
+    {
+        while (parent[x] != x)
+        {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
+
+    // 合并x、y所在的集合，较小的树挂到较大的树下；原来不在同一集合时返回true
+    bool unite(VertexId x, VertexId y)
+    {
+        x = find(x);
+        y = find(y);
+        if (x == y)
+            return false;
+        if (size[x] < size[y])
+            std::swap(x, y);
+        parent[y] = x;
+        size[x] += size[y];
+        sets--;
+        return true;
+    }
+
+    // 批量合并一组边的两端，返回实际发生合并的次数
+    template <typename Edge>
+    std::size_t uniteAll(const std::vector<Edge> &edges)
+    {
+        std::size_t merged = 0;
+        for (const Edge &e : edges)
+            merged += unite(e.from, e.to);
+        return merged;
+    }
+
+    bool connected(VertexId x, VertexId y) { return find(x) == find(y); }
+    VertexId count() const { return sets; }
+    VertexId setSize(VertexId x) { return size[find(x)]; }
+    VertexId elements() const { return static_cast<VertexId>(parent.size()); }
+};
+
+// 可由多个线程同时使用的并查集
+// 双亲只会指向编号更小的元素，不会形成环；find只做有界次数的读和普通写，不会等待其他线程，
+// unite用CAS把编号较大的根挂到较小的根下，失败时说明其他线程已经推进，重新查找后重试
+class ConcurrentUnionFind
+{
+private:
+    std::vector<VertexId> parent; // 各元素的双亲，用__atomic内建函数访问
+    std::atomic<VertexId> sets;   // 当前的集合个数
+
+    VertexId load(VertexId x) const { return __atomic_load_n(&parent[x], __ATOMIC_RELAXED); }
+
+public:
+    explicit ConcurrentUnionFind(VertexId n, int threads = 0) : parent(n), sets(n)
+    {
+        ParallelFor(threads, n, [this](std::size_t lo, std::size_t hi)
+                    {
+            for (std::size_t v = lo; v < hi; v++)
+                parent[v] = static_cast<VertexId>(v); });
+    }
+
+    // 查找x所在集合的根，路径减半；其他线程同时改写时写入的仍是x的祖先，不需要CAS
+    VertexId find(VertexId x)
+    {
+        for (;;)
+        {
+            VertexId p = load(x);
+            if (p == x)
+                return x;
+            VertexId gp = load(p);
+            if (gp != p)
+                __atomic_store_n(&parent[x], gp, __ATOMIC_RELAXED);
+            x = gp;
+        }
+    }
+
+    // 合并x、y所在的集合；多个线程合并同一对集合时只有一个返回true
+    bool unite(VertexId x, VertexId y)
+    {
+        for (;;)
+        {
+            x = find(x);
+            y = find(y);
+            if (x == y)
+                return false;
+            if (x < y)
+                std::swap(x, y);
+            VertexId expected = x;
+            if (__atomic_compare_exchange_n(&parent[x], &expected, y, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                sets.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+
+    // 并行批量合并一组边的两端，返回实际发生合并的次数
+    template <typename Edge>
+    std::size_t uniteAll(const std::vector<Edge> &edges, int threads = 0)
+    {
+        std::atomic<std::size_t> merged(0);
+        ParallelFor(threads, edges.size(), [&](std::size_t lo, std::size_t hi)
+                    {
+            std::size_t m = 0;
+            for (std::size_t i = lo; i < hi; i++)
+                m += unite(edges[i].from, edges[i].to);
+            merged += m; });
+        return merged;
+    }
+
+    // 所有合并结束后调用：并行地把每个元素直接指向根，label[v]即v所在集合中编号最小的元素
+    void labels(std::vector<VertexId> &label, int threads = 0)
+    {
+        label.resize(parent.size());
+        ParallelFor(threads, parent.size(), [&](std::size_t lo, std::size_t hi)
+                    {
+            for (std::size_t v = lo; v < hi; v++)
+                label[v] = find(static_cast<VertexId>(v)); });
+    }
+
+    bool connected(VertexId x, VertexId y) { return find(x) == find(y); }
+    VertexId count() const { return sets.load(std::memory_order_relaxed); }
+    VertexId elements() const { return static_cast<VertexId>(parent.size()); }
+};
+
+#endif // UNIONFIND_H
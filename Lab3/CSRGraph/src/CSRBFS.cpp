@@ -0,0 +1,230 @@
+// CSRBFS.cpp
+#include "CSRGraph.h"
+#include "CSRParallel.h"
+#include <utility>
+using namespace std;
+
+#define BFS_ALPHA 15 // frontier的出弧数超过未访问顶点出弧数的1/ALPHA时转为自底向上
+#define BFS_BETA 18  // frontier顶点数少于vexnum的1/BETA且在缩小时转回自顶向下
+
+static inline bool testBit(const vector<uint64_t> &bits, VertexId v)
+{
+    return (bits[v >> 6] >> (v & 63)) & 1;
+}
+
+// 原子地置位，该位原来为0时返回true（只有一个线程能得到true）
+static inline bool claimBit(vector<uint64_t> &bits, VertexId v)
+{
+    uint64_t bit = 1ull << (v & 63);
+    if (__atomic_load_n(&bits[v >> 6], __ATOMIC_RELAXED) & bit)
+        return false;
+    return !(__atomic_fetch_or(&bits[v >> 6], bit, __ATOMIC_RELAXED) & bit);
+}
+
+static inline EdgeId outDegree(const CSRGraph &G, VertexId v)
+{
+    return G.offset[v + 1] - G.offset[v];
+}
+
+/**
+ * 自顶向下扩展一层
+ * @param G CSR图
+ * @param frontier 当前层的顶点
+ * @param nf 当前层的顶点数
+ * @param next 下一层的顶点
+ * @param visited 已访问位图
+ * @param r BFS结果
+ * @param depth 当前层数
+ * @param threads 线程数
+ * @param mf 返回下一层顶点的出弧总数
+ * @return 下一层的顶点数
+ *
+ * 算法实现:
+ * 1. 并行扫描当前层顶点的出弧，用原子置位抢占未访问的邻接点，抢到的线程写入parent和level。
+ * 2. 新顶点先放入各段自己的缓冲区，段结束时用一次原子加在next中领取位置后整体复制。
+ */
+static size_t topDownStep(const CSRGraph &G, const vector<VertexId> &frontier, size_t nf, vector<VertexId> &next,
+                          vector<uint64_t> &visited, CSRBFSResult &r, VertexId depth, int threads, EdgeId &mf)
+{
+    atomic<size_t> size(0);
+    atomic<EdgeId> edges(0);
+    ParallelFor(threads, nf, [&](size_t lo, size_t hi)
+                {
+        vector<VertexId> local;
+        EdgeId m = 0;
+        for (size_t k = lo; k < hi; k++)
+        {
+            VertexId v = frontier[k];
+            for (EdgeId e = G.offset[v]; e < G.offset[v + 1]; e++)
+            {
+                VertexId w = G.adj[e];
+                if (claimBit(visited, w))
+                {
+                    r.parent[w] = v;
+                    r.level[w] = depth + 1;
+                    local.push_back(w);
+                    m += outDegree(G, w);
+                }
+            }
+        }
+        size_t pos = size.fetch_add(local.size());
+        copy(local.begin(), local.end(), next.begin() + pos);
+        edges += m; });
+    mf = edges;
+    return size;
+}
+
+/**
+ * 自底向上扩展一层
+ * @param G CSR图
+ * @param inOffset 入弧的行起点（无向图即出弧）
+ * @param inAdj 入弧的起点
+ * @param front 当前层的位图
+ * @param next 下一层的位图
+ * @param visited 已访问位图
+ * @param r BFS结果
+ * @param depth 当前层数
+ * @param threads 线程数
+ * @param mf 返回下一层顶点的出弧总数
+ * @return 下一层的顶点数
+ *
+ * 算法实现:
+ * 1. 每个未访问的顶点检查自己的入弧，找到一个在当前层中的前驱即停止，前驱较多时只需看很少几条弧。
+ * 2. 按64个顶点一个字划分任务，一个字只由一个线程读写，visited和next都不需要原子操作。
+ */
+static size_t bottomUpStep(const CSRGraph &G, const vector<EdgeId> &inOffset, const vector<VertexId> &inAdj,
+                           const vector<uint64_t> &front, vector<uint64_t> &next, vector<uint64_t> &visited,
+                           CSRBFSResult &r, VertexId depth, int threads, EdgeId &mf)
+{
+    atomic<size_t> count(0);
+    atomic<EdgeId> edges(0);
+    ParallelFor(threads, visited.size(), [&](size_t lo, size_t hi)
+                {
+        size_t c = 0;
+        EdgeId m = 0;
+        for (size_t wi = lo; wi < hi; wi++)
+        {
+            uint64_t unvisited = ~visited[wi], add = 0;
+            while (unvisited)
+            {
+                int b = __builtin_ctzll(unvisited);
+                unvisited &= unvisited - 1;
+                VertexId v = static_cast<VertexId>(wi * 64 + b);
+                for (EdgeId e = inOffset[v]; e < inOffset[v + 1]; e++)
+                {
+                    VertexId u = inAdj[e];
+                    if (testBit(front, u))
+                    {
+                        r.parent[v] = u;
+                        r.level[v] = depth + 1;
+                        add |= 1ull << b;
+                        m += outDegree(G, v);
+                        break;
+                    }
+                }
+            }
+            next[wi] = add;
+            visited[wi] |= add;
+            c += __builtin_popcountll(add);
+        }
+        count += c;
+        edges += m; });
+    mf = edges;
+    return count;
+}
+
+// 顶点队列转为位图
+static void queueToBitmap(const vector<VertexId> &frontier, size_t nf, vector<uint64_t> &bits, int threads)
+{
+    ParallelFor(threads, bits.size(), [&](size_t lo, size_t hi)
+                { fill(bits.begin() + lo, bits.begin() + hi, 0); });
+    ParallelFor(threads, nf, [&](size_t lo, size_t hi)
+                {
+        for (size_t k = lo; k < hi; k++)
+            __atomic_fetch_or(&bits[frontier[k] >> 6], 1ull << (frontier[k] & 63), __ATOMIC_RELAXED); });
+}
+
+// 位图转为顶点队列，返回顶点数
+static size_t bitmapToQueue(const vector<uint64_t> &bits, vector<VertexId> &frontier, int threads)
+{
+    atomic<size_t> size(0);
+    ParallelFor(threads, bits.size(), [&](size_t lo, size_t hi)
+                {
+        vector<VertexId> local;
+        for (size_t wi = lo; wi < hi; wi++)
+            for (uint64_t x = bits[wi]; x; x &= x - 1)
+                local.push_back(static_cast<VertexId>(wi * 64 + __builtin_ctzll(x)));
+        size_t pos = size.fetch_add(local.size());
+        copy(local.begin(), local.end(), frontier.begin() + pos); });
+    return size;
+}
+
+/**
+ * 方向优化的并行广度优先搜索（Beamer）
+ * @param G CSR图；有向图需先调用BuildCSRReverse才能使用自底向上的方式
+ * @param source 源点
+ * @param result BFS树的双亲与各顶点的层数
+ * @param threads 线程数，0表示使用硬件并发数
+ *
+ * 算法实现:
+ * 1. 逐层扩展，frontier较小时自顶向下：由当前层的出弧去找未访问的顶点。
+ * 2. frontier的出弧数mf超过未访问顶点出弧数mu的1/BFS_ALPHA时转为自底向上：
+ *    由未访问的顶点去找当前层中的前驱，此时大部分顶点很快就能找到，省去大量无用的弧检查。
+ * 3. frontier缩小到vexnum的1/BFS_BETA以下时转回自顶向下。
+ * 4. 自顶向下用顶点队列表示frontier，自底向上用位图表示，切换时并行转换；已访问集合始终是位图。
+ */
+void CSRParallelBFS(const CSRGraph &G, VertexId source, CSRBFSResult &result, int threads)
+{
+    VertexId n = G.vexnum;
+    result.parent.assign(n, CSR_NO_VERTEX);
+    result.level.assign(n, CSR_NO_VERTEX);
+    result.reached = 0;
+    if (source >= n)
+        return;
+
+    bool directed = IsDirected(G);
+    bool canBottomUp = !directed || !G.inOffset.empty();
+    const vector<EdgeId> &inOffset = directed ? G.inOffset : G.offset;
+    const vector<VertexId> &inAdj = directed ? G.inAdj : G.adj;
+
+    size_t words = (static_cast<size_t>(n) + 63) / 64;
+    vector<uint64_t> visited(words, 0), front(words), next(words);
+    if (n % 64)
+        visited[words - 1] = ~0ull << (n % 64); // 末尾不存在的顶点视为已访问
+    vector<VertexId> frontier(n), nextFrontier(n);
+
+    frontier[0] = source;
+    claimBit(visited, source);
+    result.parent[source] = source;
+    result.level[source] = 0;
+    size_t nf = 1, reached = 1;
+    EdgeId mf = outDegree(G, source), mu = G.adj.size() - mf;
+    bool bottomUp = false;
+    for (VertexId depth = 0; nf > 0; depth++)
+    {
+        size_t prev = nf;
+        if (!bottomUp && canBottomUp && mf > mu / BFS_ALPHA)
+        {
+            queueToBitmap(frontier, nf, front, threads);
+            bottomUp = true;
+        }
+        if (bottomUp)
+        {
+            nf = bottomUpStep(G, inOffset, inAdj, front, next, visited, result, depth, threads, mf);
+            swap(front, next);
+            if (nf < n / BFS_BETA && nf < prev)
+            {
+                bitmapToQueue(front, frontier, threads);
+                bottomUp = false;
+            }
+        }
+        else
+        {
+            nf = topDownStep(G, frontier, nf, nextFrontier, visited, result, depth, threads, mf);
+            swap(frontier, nextFrontier);
+        }
+        mu -= mf;
+        reached += nf;
+    }
+    result.reached = static_cast<VertexId>(reached);
+}
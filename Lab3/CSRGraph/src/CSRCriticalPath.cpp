@@ -0,0 +1,67 @@
+// CSRCriticalPath.cpp
+#include "CSRGraph.h"
+#include <algorithm>
+using namespace std;
+
+/**
+ * 求AOE网的关键路径
+ * @param G CSR有向网，弧的权值为活动持续时间
+ * @param result 各事件的ve、vl，拓扑序列，关键活动与工期
+ * @return 网中有环时返回false
+ *
+ * 算法实现:
+ * 1. 由出弧统计入度，用Kahn算法求拓扑序列；序列长度不足vexnum说明有环。
+ * 2. 按拓扑序正向计算ve[v] = max(ve[u] + w)。
+ * 3. vl初始化为工期，按拓扑逆序对每个顶点u取vl[u] = min(vl[v] - w)，只需扫描u的出弧，
+ *    每条弧恰好检查一次，总复杂度O(V + E)。
+ * 4. ve[u] == vl[v] - w的活动u->v即关键活动，按拓扑序输出。
+ */
+bool CSRCriticalPath(const CSRGraph &G, CSRCriticalPathResult &result)
+{
+    VertexId n = G.vexnum;
+    vector<VertexId> indegree(n, 0);
+    for (VertexId v : G.adj)
+        indegree[v]++;
+    vector<VertexId> &topo = result.topo;
+    topo.clear();
+    topo.reserve(n);
+    for (VertexId v = 0; v < n; v++)
+        if (indegree[v] == 0)
+            topo.push_back(v);
+    for (size_t head = 0; head < topo.size(); head++)
+    {
+        VertexId u = topo[head];
+        for (EdgeId e = G.offset[u]; e < G.offset[u + 1]; e++)
+            if (--indegree[G.adj[e]] == 0)
+                topo.push_back(G.adj[e]);
+    }
+    result.critical.clear();
+    if (topo.size() != n)
+    {
+        result.ve.clear();
+        result.vl.clear();
+        result.length = 0;
+        return false;
+    }
+
+    vector<long long> &ve = result.ve, &vl = result.vl;
+    ve.assign(n, 0);
+    for (VertexId u : topo)
+        for (EdgeId e = G.offset[u]; e < G.offset[u + 1]; e++)
+            ve[G.adj[e]] = max(ve[G.adj[e]], ve[u] + ArcWeight(G, e));
+    result.length = n == 0 ? 0 : *max_element(ve.begin(), ve.end());
+
+    vl.assign(n, result.length);
+    for (size_t k = n; k-- > 0;)
+    {
+        VertexId u = topo[k];
+        for (EdgeId e = G.offset[u]; e < G.offset[u + 1]; e++)
+            vl[u] = min(vl[u], vl[G.adj[e]] - ArcWeight(G, e));
+    }
+
+    for (VertexId u : topo)
+        for (EdgeId e = G.offset[u]; e < G.offset[u + 1]; e++)
+            if (ve[u] == vl[G.adj[e]] - ArcWeight(G, e))
+                result.critical.push_back(CSRArc{u, G.adj[e], ArcWeight(G, e)});
+    return true;
+}
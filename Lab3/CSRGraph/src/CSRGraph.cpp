@@ -0,0 +1,272 @@
+// CSRGraph.cpp
+#include "CSRGraph.h"
+#include "CSRParallel.h"
+#include <iostream>
+#include <utility>
+using namespace std;
+
+/**
+ * 并行计数排序构造一组CSR数组
+ * @param vexnum 顶点数
+ * @param items 输入项数
+ * @param weighted 是否保存权值
+ * @param threads 线程数
+ * @param each each(k, emit)对第k项调用emit(u, v, w)若干次，表示弧u->v
+ * @param offset 各行起点
+ * @param adj 各弧终点
+ * @param weight 各弧权值
+ *
+ * 算法实现:
+ * 1. 各线程分段扫描输入，用原子加统计每行的弧数，写在offset[u]中。
+ * 2. 并行前缀和把行长度变为行起点，offset[vexnum]为总弧数。
+ * 3. 复制行起点作为写入游标，再扫描一遍输入，用原子加领取位置并写入终点和权值。
+ * 4. 行内次序取决于线程调度，最后并行把每行按(终点, 权值)排序，使结果与线程数无关。
+ * 计数和写入都是O(V + E)，行内排序只涉及各行自身。
+ */
+template <typename Each>
+static void buildRows(VertexId vexnum, size_t items, bool weighted, int threads, Each each,
+                      vector<EdgeId> &offset, vector<VertexId> &adj, vector<VRType> &weight)
+{
+    offset.assign(static_cast<size_t>(vexnum) + 1, 0);
+    ParallelFor(threads, items, [&](size_t lo, size_t hi)
+                {
+        for (size_t k = lo; k < hi; k++)
+            each(k, [&](VertexId u, VertexId, VRType)
+                 { __atomic_fetch_add(&offset[u], 1, __ATOMIC_RELAXED); }); });
+    ParallelExclusiveScan(threads, offset);
+
+    EdgeId total = offset[vexnum];
+    adj.resize(total);
+    if (weighted)
+        weight.resize(total);
+    else
+        weight.clear();
+    vector<EdgeId> cursor(offset.begin(), offset.end() - 1);
+    ParallelFor(threads, items, [&](size_t lo, size_t hi)
+                {
+        for (size_t k = lo; k < hi; k++)
+            each(k, [&](VertexId u, VertexId v, VRType w)
+                 {
+                EdgeId pos = __atomic_fetch_add(&cursor[u], 1, __ATOMIC_RELAXED);
+                adj[pos] = v;
+                if (weighted)
+                    weight[pos] = w; }); });
+
+    ParallelFor(threads, vexnum, [&](size_t lo, size_t hi)
+                {
+        vector<pair<VertexId, VRType>> row;
+        for (size_t v = lo; v < hi; v++)
+        {
+            EdgeId b = offset[v], e = offset[v + 1];
+            if (e - b < 2)
+                continue;
+            if (!weighted)
+            {
+                sort(adj.begin() + b, adj.begin() + e);
+                continue;
+            }
+            row.clear();
+            for (EdgeId i = b; i < e; i++)
+                row.push_back(make_pair(adj[i], weight[i]));
+            sort(row.begin(), row.end());
+            for (EdgeId i = b; i < e; i++)
+            {
+                adj[i] = row[i - b].first;
+                weight[i] = row[i - b].second;
+            }
+        } });
+}
+
+/**
+ * 由弧列表构造CSR图的公共部分
+ * @param GKind 图的类型
+ * @param G CSR图
+ * @param vexnum 顶点数
+ * @param arcnum 弧数
+ * @param arc arc(k, u, v, w)取出第k条弧，顶点编号越界时返回false
+ * @param threads 线程数
+ * @return 成功返回1，顶点编号越界返回-1
+ */
+template <typename GetArc>
+static Status createFromArcs(GraphKind GKind, CSRGraph &G, VertexId vexnum, EdgeId arcnum, GetArc arc, int threads)
+{
+    atomic<bool> valid(true);
+    ParallelFor(threads, arcnum, [&](size_t lo, size_t hi)
+                {
+        VertexId u = 0, v = 0;
+        VRType w = 0;
+        for (size_t k = lo; k < hi; k++)
+        {
+            if (!arc(k, u, v, w) || u >= vexnum || v >= vexnum)
+            {
+                valid = false;
+                return;
+            }
+        } });
+    if (!valid)
+        return -1;
+
+    G.kind = GKind;
+    G.vexnum = vexnum;
+    G.arcnum = arcnum;
+    G.inOffset.clear();
+    G.inAdj.clear();
+    G.inWeight.clear();
+    bool undirected = !IsDirected(G);
+    bool weighted = GKind == DN || GKind == UDN;
+    buildRows(vexnum, arcnum, weighted, threads, [&](size_t k, auto emit)
+              {
+        VertexId u = 0, v = 0;
+        VRType w = 0;
+        arc(k, u, v, w);
+        emit(u, v, w);
+        if (undirected)
+            emit(v, u, w); }, G.offset, G.adj, G.weight);
+    return 1;
+}
+
+/**
+ * 由三元组弧数组创建CSR图，参数与CreateMGraph一致
+ * @param GKind 图的类型
+ * @param G CSR图
+ * @param vexnum 顶点数
+ * @param arcnum 弧数
+ * @param vexs 顶点名称，可为nullptr
+ * @param arcs 弧数组，每条弧为(i, j, w)三元组
+ * @param threads 线程数，0表示使用硬件并发数
+ * @return 成功返回1，顶点编号越界返回-1
+ */
+Status CreateCSRGraph(GraphKind GKind, CSRGraph &G, VertexId vexnum, EdgeId arcnum, const VertexType *vexs,
+                      const int *arcs, int threads)
+{
+    Status s = createFromArcs(GKind, G, vexnum, arcnum, [arcs](size_t k, VertexId &u, VertexId &v, VRType &w)
+                              {
+        if (arcs[3 * k] < 0 || arcs[3 * k + 1] < 0)
+            return false;
+        u = static_cast<VertexId>(arcs[3 * k]);
+        v = static_cast<VertexId>(arcs[3 * k + 1]);
+        w = arcs[3 * k + 2];
+        return true; }, threads);
+    if (s == 1)
+    {
+        if (vexs)
+            G.vexs.assign(vexs, vexs + vexnum);
+        else
+            G.vexs.clear();
+    }
+    return s;
+}
+
+/**
+ * 由分开存放的起点、终点、权值数组创建CSR图，适用于大规模边表
+ * @param GKind 图的类型
+ * @param G CSR图
+ * @param vexnum 顶点数
+ * @param from 各弧起点
+ * @param to 各弧终点
+ * @param w 各弧权值，无权图可为空
+ * @param threads 线程数，0表示使用硬件并发数
+ * @return 成功返回1，数组长度不一致或顶点编号越界返回-1
+ */
+Status CreateCSRGraph(GraphKind GKind, CSRGraph &G, VertexId vexnum, const vector<VertexId> &from,
+                      const vector<VertexId> &to, const vector<VRType> &w, int threads)
+{
+    if (from.size() != to.size() || (!w.empty() && w.size() != from.size()))
+        return -1;
+    Status s = createFromArcs(GKind, G, vexnum, from.size(), [&](size_t k, VertexId &u, VertexId &v, VRType &x)
+                              {
+        u = from[k];
+        v = to[k];
+        x = w.empty() ? 1 : w[k];
+        return true; }, threads);
+    if (s == 1)
+        G.vexs.clear();
+    return s;
+}
+
+/**
+ * 为有向图建立入弧的CSR数组
+ * @param G CSR图
+ * @param threads 线程数，0表示使用硬件并发数
+ *
+ * 算法实现:
+ * 1. 按顶点并行扫描出弧，每条出弧u->v贡献一条入弧，同样用并行计数排序放入v的行。
+ * 2. 无向图的入弧与出弧相同，不另外存储。
+ */
+void BuildCSRReverse(CSRGraph &G, int threads)
+{
+    if (!IsDirected(G))
+        return;
+    bool weighted = !G.weight.empty();
+    buildRows(G.vexnum, G.vexnum, weighted, threads, [&G](size_t u, auto emit)
+              {
+        for (EdgeId e = G.offset[u]; e < G.offset[u + 1]; e++)
+            emit(G.adj[e], static_cast<VertexId>(u), ArcWeight(G, e)); }, G.inOffset, G.inAdj, G.inWeight);
+}
+
+// 顶点名称，没有名称时输出编号
+static void outVertex(const CSRGraph &G, VertexId v)
+{
+    if (G.vexs.empty())
+        cout << v;
+    else
+        cout << G.vexs[v];
+}
+
+// 输出图的CSR存储（适用于小图）
+void OutCSRGraph(const CSRGraph &G)
+{
+    cout << "顶点数: " << G.vexnum << ", 弧数: " << G.arcnum << endl;
+    for (VertexId v = 0; v < G.vexnum; v++)
+    {
+        outVertex(G, v);
+        cout << ":";
+        for (EdgeId e = G.offset[v]; e < G.offset[v + 1]; e++)
+        {
+            cout << " ";
+            outVertex(G, G.adj[e]);
+            if (!G.weight.empty())
+                cout << "(" << G.weight[e] << ")";
+        }
+        cout << endl;
+    }
+}
+
+/**
+ * 计算各顶点的入度和出度
+ * @param G CSR图
+ * @param inDegree 各顶点入度
+ * @param outDegree 各顶点出度
+ * @param threads 线程数，0表示使用硬件并发数
+ *
+ * 算法实现:
+ * 1. 出度直接由相邻两个行起点相减得到。
+ * 2. 有向图已建立入弧时入度同样由行起点相减，否则并行扫描终点数组用原子加统计。
+ * 3. 无向图的入度与出度相同，都是度。
+ */
+void CSRVerDegree(const CSRGraph &G, vector<EdgeId> &inDegree, vector<EdgeId> &outDegree, int threads)
+{
+    outDegree.resize(G.vexnum);
+    ParallelFor(threads, G.vexnum, [&](size_t lo, size_t hi)
+                {
+        for (size_t v = lo; v < hi; v++)
+            outDegree[v] = G.offset[v + 1] - G.offset[v]; });
+    if (!IsDirected(G))
+    {
+        inDegree = outDegree;
+        return;
+    }
+    inDegree.assign(G.vexnum, 0);
+    if (!G.inOffset.empty())
+    {
+        ParallelFor(threads, G.vexnum, [&](size_t lo, size_t hi)
+                    {
+            for (size_t v = lo; v < hi; v++)
+                inDegree[v] = G.inOffset[v + 1] - G.inOffset[v]; });
+        return;
+    }
+    ParallelFor(threads, G.adj.size(), [&](size_t lo, size_t hi)
+                {
+        for (size_t e = lo; e < hi; e++)
+            __atomic_fetch_add(&inDegree[G.adj[e]], 1, __ATOMIC_RELAXED); });
+}
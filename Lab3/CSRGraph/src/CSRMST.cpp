@@ -0,0 +1,240 @@
+// CSRMST.cpp
+#include "CSRGraph.h"
+#include "CSRParallel.h"
+#include "UnionFind.h"
+#include <tuple>
+using namespace std;
+
+#define FILTER_KRUSKAL_BASE 4096 // 边数不超过该值时直接排序做Kruskal
+
+static inline bool lighter(const CSRArc &a, const CSRArc &b)
+{
+    return tie(a.weight, a.from, a.to) < tie(b.weight, b.from, b.to);
+}
+
+/**
+ * 取出图中的边，每条无向边只取一次（u < v），自环丢弃
+ * @param G CSR图
+ * @param edges 边列表
+ * @param threads 线程数
+ *
+ * 算法实现:
+ * 1. 并行统计每段顶点贡献的边数，前缀和得到各段的写入位置，再并行写入，保持按起点有序。
+ */
+static void collectEdges(const CSRGraph &G, vector<CSRArc> &edges, int threads)
+{
+    int parts = CSRThreads(threads) * 4;
+    size_t len = (static_cast<size_t>(G.vexnum) + parts - 1) / parts;
+    vector<EdgeId> start(parts + 1, 0);
+    auto keep = [&G](VertexId u, EdgeId e)
+    { return IsDirected(G) ? u != G.adj[e] : u < G.adj[e]; };
+    ParallelFor(threads, parts, [&](size_t lo, size_t hi)
+                {
+        for (size_t p = lo; p < hi; p++)
+        {
+            EdgeId c = 0;
+            for (size_t u = p * len; u < min<size_t>(G.vexnum, (p + 1) * len); u++)
+                for (EdgeId e = G.offset[u]; e < G.offset[u + 1]; e++)
+                    c += keep(static_cast<VertexId>(u), e);
+            start[p] = c;
+        } });
+    ParallelExclusiveScan(threads, start);
+    edges.resize(start[parts]);
+    ParallelFor(threads, parts, [&](size_t lo, size_t hi)
+                {
+        for (size_t p = lo; p < hi; p++)
+        {
+            EdgeId k = start[p];
+            for (size_t u = p * len; u < min<size_t>(G.vexnum, (p + 1) * len); u++)
+                for (EdgeId e = G.offset[u]; e < G.offset[u + 1]; e++)
+                    if (keep(static_cast<VertexId>(u), e))
+                        edges[k++] = CSRArc{static_cast<VertexId>(u), G.adj[e], ArcWeight(G, e)};
+        } });
+}
+
+/**
+ * 并行删除两端已连通的边，保留的边顺序不变
+ * @param edges 边列表，原位压缩
+ * @param lo 起点
+ * @param hi 终点
+ * @param uf 并查集
+ * @param threads 线程数
+ * @return 保留的边数，保留的边放在[lo, lo + 返回值)
+ */
+static size_t filterConnected(vector<CSRArc> &edges, size_t lo, size_t hi, ConcurrentUnionFind &uf, int threads)
+{
+    size_t n = hi - lo;
+    int parts = static_cast<int>(min<size_t>(CSRThreads(threads) * 4, max<size_t>(1, n / 4096)));
+    size_t len = (n + parts - 1) / parts;
+    vector<size_t> kept(parts + 1, 0);
+    // 各段先在段内压缩，再依次前移
+    ParallelFor(threads, parts, [&](size_t a, size_t b)
+                {
+        for (size_t p = a; p < b; p++)
+        {
+            size_t from = lo + p * len, to = min(hi, from + len), k = from;
+            for (size_t i = from; i < to; i++)
+                if (!uf.connected(edges[i].from, edges[i].to))
+                    edges[k++] = edges[i];
+            kept[p] = k - from;
+        } });
+    size_t k = lo;
+    for (int p = 0; p < parts; p++)
+    {
+        size_t from = lo + p * len;
+        if (k != from)
+            copy(edges.begin() + from, edges.begin() + from + kept[p], edges.begin() + k);
+        k += kept[p];
+    }
+    return k - lo;
+}
+
+/**
+ * Filter-Kruskal的递归部分
+ * @param edges 边列表
+ * @param lo 起点
+ * @param hi 终点
+ * @param uf 并查集
+ * @param tree 生成树的边
+ * @param need 还需要的边数
+ * @param threads 线程数
+ *
+ * 算法实现:
+ * 1. 边数较少时排序后做普通Kruskal。
+ * 2. 否则取三个样本的中位数为枢轴，划分为较轻与较重两部分，先递归处理较轻的边。
+ * 3. 处理较重的边之前，删去两端已经连通的边：随着树变大，绝大部分重边在这一步被过滤，无需排序。
+ */
+static void filterKruskal(vector<CSRArc> &edges, size_t lo, size_t hi, ConcurrentUnionFind &uf,
+                          vector<CSRArc> &tree, size_t need, int threads)
+{
+    if (tree.size() >= need || lo >= hi)
+        return;
+    if (hi - lo <= FILTER_KRUSKAL_BASE)
+    {
+        sort(edges.begin() + lo, edges.begin() + hi, lighter);
+        for (size_t i = lo; i < hi && tree.size() < need; i++)
+            if (uf.unite(edges[i].from, edges[i].to))
+                tree.push_back(edges[i]);
+        return;
+    }
+    CSRArc a = edges[lo], b = edges[lo + (hi - lo) / 2], c = edges[hi - 1];
+    CSRArc pivot = lighter(a, b) ? (lighter(b, c) ? b : (lighter(a, c) ? c : a))
+                                 : (lighter(a, c) ? a : (lighter(b, c) ? c : b));
+    size_t mid = partition(edges.begin() + lo, edges.begin() + hi, [&pivot](const CSRArc &e)
+                           { return !lighter(pivot, e); }) -
+                 edges.begin();
+    if (mid == hi)
+    {
+        // 枢轴是最重的边：全部较轻，直接排序
+        sort(edges.begin() + lo, edges.begin() + hi, lighter);
+        for (size_t i = lo; i < hi && tree.size() < need; i++)
+            if (uf.unite(edges[i].from, edges[i].to))
+                tree.push_back(edges[i]);
+        return;
+    }
+    filterKruskal(edges, lo, mid, uf, tree, need, threads);
+    if (tree.size() >= need)
+        return;
+    size_t kept = filterConnected(edges, mid, hi, uf, threads);
+    filterKruskal(edges, mid, mid + kept, uf, tree, need, threads);
+}
+
+/**
+ * Filter-Kruskal算法求最小生成森林
+ * @param G CSR无向网
+ * @param tree 生成森林的边，按(权值, u, v)非递减排列
+ * @param threads 线程数，0表示使用硬件并发数
+ * @return 总权值
+ */
+long long CSRFilterKruskal(const CSRGraph &G, vector<CSRArc> &tree, int threads)
+{
+    vector<CSRArc> edges;
+    collectEdges(G, edges, threads);
+    ConcurrentUnionFind uf(G.vexnum, threads);
+    tree.clear();
+    size_t need = G.vexnum > 0 ? G.vexnum - 1 : 0;
+    filterKruskal(edges, 0, edges.size(), uf, tree, need, threads);
+    long long total = 0;
+    for (const CSRArc &e : tree)
+        total += e.weight;
+    return total;
+}
+
+/**
+ * 并行Borůvka算法求最小生成森林
+ * @param G CSR无向网
+ * @param tree 生成森林的边
+ * @param threads 线程数，0表示使用硬件并发数
+ * @return 总权值
+ *
+ * 算法实现:
+ * 1. 每一轮并行扫描剩余的边，用CAS把它记为两端分量的候选最轻边，
+ *    按(权值, 边的下标)比较，保证各分量选出的边不会构成环。
+ * 2. 并行处理各分量的候选边，用无锁并查集合并两端，合并成功的边加入森林。
+ * 3. 并行压缩边列表，去掉两端已连通的边。每轮分量数至少减半，共O(log V)轮，每轮O(E)。
+ */
+long long CSRBoruvka(const CSRGraph &G, vector<CSRArc> &tree, int threads)
+{
+    const EdgeId NONE = ~0ull;
+    vector<CSRArc> edges;
+    collectEdges(G, edges, threads);
+    ConcurrentUnionFind uf(G.vexnum, threads);
+    vector<EdgeId> best(G.vexnum, NONE);
+    tree.clear();
+
+    // (权值, 下标)更小的边更优
+    auto better = [&edges](EdgeId x, EdgeId y)
+    { return y == NONE || edges[x].weight < edges[y].weight || (edges[x].weight == edges[y].weight && x < y); };
+    auto offer = [&](VertexId c, EdgeId e)
+    {
+        EdgeId cur = __atomic_load_n(&best[c], __ATOMIC_RELAXED);
+        while (better(e, cur))
+            if (__atomic_compare_exchange_n(&best[c], &cur, e, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                break;
+    };
+
+    vector<VertexId> roots;
+    while (!edges.empty() && uf.count() > 1)
+    {
+        ParallelFor(threads, edges.size(), [&](size_t lo, size_t hi)
+                    {
+            for (size_t i = lo; i < hi; i++)
+            {
+                VertexId cu = uf.find(edges[i].from), cv = uf.find(edges[i].to);
+                if (cu == cv)
+                    continue;
+                offer(cu, i);
+                offer(cv, i);
+            } });
+
+        // 有候选边的顶点即本轮的各分量的根
+        roots.clear();
+        for (VertexId v = 0; v < G.vexnum; v++)
+            if (best[v] != NONE)
+                roots.push_back(v);
+        if (roots.empty())
+            break;
+
+        atomic<size_t> added(tree.size());
+        tree.resize(tree.size() + roots.size());
+        ParallelFor(threads, roots.size(), [&](size_t lo, size_t hi)
+                    {
+            for (size_t k = lo; k < hi; k++)
+            {
+                const CSRArc &e = edges[best[roots[k]]];
+                if (uf.unite(e.from, e.to))
+                    tree[added++] = e;
+            } });
+        tree.resize(added);
+        for (VertexId r : roots)
+            best[r] = NONE;
+
+        // 压缩边列表：删去两端已连通的边
+        edges.resize(filterConnected(edges, 0, edges.size(), uf, threads));
+    }
+
+    long long total = 0;
+    for (const CSRArc &e : tree)
+        total += e.weight;
+    return total;
+}
@@ -0,0 +1,252 @@
+// CSRShortestPath.cpp
+#include "CSRGraph.h"
+#include "CSRHeap.h"
+#include "CSRParallel.h"
+using namespace std;
+
+#define DELTA_MAX_BUCKETS 65536 // Δ-stepping循环桶数组的桶数上限
+
+static void initResult(const CSRGraph &G, CSRShortestPathResult &r)
+{
+    r.dist.assign(G.vexnum, CSR_NO_PATH);
+    r.pred.assign(G.vexnum, CSR_NO_VERTEX);
+}
+
+// 原子地令x = min(x, value)，x确实变小时返回true
+static inline bool atomicMin(long long &x, long long value)
+{
+    long long cur = __atomic_load_n(&x, __ATOMIC_RELAXED);
+    while (value < cur)
+        if (__atomic_compare_exchange_n(&x, &cur, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            return true;
+    return false;
+}
+
+/**
+ * Dijkstra算法求单源最短路径
+ * @param G CSR图，无权图每条弧的权值为1
+ * @param source 源点
+ * @param result 各顶点的最短路径长度与前驱
+ * @return 成功返回1；源点越界或遇到负权弧返回-1
+ *
+ * 算法实现:
+ * 1. 用基数堆代替比较堆：Dijkstra弹出的距离单调不减，每个元素至多在65个桶之间下移，均摊O(log C)。
+ * 2. 不做decrease-key，距离变小时直接插入新项，弹出的距离与dist不符的是过期项，跳过。
+ * 3. 总复杂度O(E + V log C)，C为最大距离。
+ */
+Status CSRDijkstra(const CSRGraph &G, VertexId source, CSRShortestPathResult &result)
+{
+    initResult(G, result);
+    if (source >= G.vexnum)
+        return -1;
+    RadixHeap<VertexId> heap;
+    result.dist[source] = 0;
+    result.pred[source] = source;
+    heap.push(0, source);
+    while (!heap.empty())
+    {
+        pair<uint64_t, VertexId> top = heap.pop();
+        VertexId u = top.second;
+        long long du = static_cast<long long>(top.first);
+        if (du != result.dist[u])
+            continue;
+        for (EdgeId e = G.offset[u]; e < G.offset[u + 1]; e++)
+        {
+            VRType w = ArcWeight(G, e);
+            if (w < 0)
+                return -1;
+            VertexId v = G.adj[e];
+            if (du + w < result.dist[v])
+            {
+                result.dist[v] = du + w;
+                result.pred[v] = u;
+                heap.push(static_cast<uint64_t>(du + w), v);
+            }
+        }
+    }
+    return 1;
+}
+
+/**
+ * 由最短距离求前驱：沿紧弧（dist[u] + w = dist[v]）从源点并行地逐层扩展
+ * @param G CSR图
+ * @param source 源点
+ * @param r 已求出dist，本函数填写pred
+ * @param threads 线程数
+ *
+ * 算法实现:
+ * 1. 每个可达顶点都有一条全由紧弧组成的路径，逐层扩展能到达所有可达顶点。
+ * 2. 用CAS抢占pred，每个顶点只有一个前驱，零权弧也不会形成环。
+ */
+static void buildPredecessors(const CSRGraph &G, VertexId source, CSRShortestPathResult &r, int threads)
+{
+    vector<VertexId> frontier(1, source), next(G.vexnum);
+    r.pred[source] = source;
+    while (!frontier.empty())
+    {
+        atomic<size_t> size(0);
+        ParallelFor(threads, frontier.size(), [&](size_t lo, size_t hi)
+                    {
+            vector<VertexId> local;
+            for (size_t k = lo; k < hi; k++)
+            {
+                VertexId u = frontier[k];
+                for (EdgeId e = G.offset[u]; e < G.offset[u + 1]; e++)
+                {
+                    VertexId v = G.adj[e], expected = CSR_NO_VERTEX;
+                    if (r.dist[u] + ArcWeight(G, e) == r.dist[v] &&
+                        __atomic_load_n(&r.pred[v], __ATOMIC_RELAXED) == CSR_NO_VERTEX &&
+                        __atomic_compare_exchange_n(&r.pred[v], &expected, u, false, __ATOMIC_RELAXED,
+                                                    __ATOMIC_RELAXED))
+                        local.push_back(v);
+                }
+            }
+            size_t pos = size.fetch_add(local.size());
+            copy(local.begin(), local.end(), next.begin() + pos); });
+        frontier.assign(next.begin(), next.begin() + size);
+    }
+}
+
+/**
+ * 并行的Δ-stepping单源最短路径
+ * @param G CSR图，无权图每条弧的权值为1
+ * @param source 源点
+ * @param result 各顶点的最短路径长度与前驱
+ * @param delta 桶宽，0表示取最大权值除以平均出度；会被调大到使桶数不超过DELTA_MAX_BUCKETS
+ * @param threads 线程数，0表示使用硬件并发数
+ * @return 成功返回1；源点越界或有负权弧返回-1
+ *
+ * 算法实现:
+ * 1. 按距离把待处理的顶点分入宽为delta的桶，从小到大处理各桶；距离落在同一个桶中的顶点可以并行松弛。
+ * 2. 取出当前桶的全部顶点，并行扫描它们的出弧，用CAS做原子min更新终点的距离，更新成功的终点先放入各段的缓冲区。
+ * 3. 汇合后把更新过的顶点按新的距离放入对应的桶（同一轮中重复的只放一次）；落回当前桶的顶点在下一轮继续处理，
+ *    直到当前桶为空。桶中距离已经变小、不再属于该桶的是过期项，跳过。
+ * 4. 待处理顶点的距离总落在[当前桶起点, 当前桶起点 + 最大权值]内，只需ceil(最大权值 / delta) + 1个桶，
+ *    第k个桶放在k % 桶数处循环使用，桶数组的大小与最大距离无关。
+ * 5. delta越小越接近并行的Dijkstra，delta取无穷时退化为Bellman-Ford；取平均意义下的中间值，轮数与重复松弛都较少。
+ * 6. 距离确定后再由buildPredecessors并行求前驱，不需要在松弛时同时原子地维护距离和前驱。
+ */
+Status CSRDeltaStepping(const CSRGraph &G, VertexId source, CSRShortestPathResult &result, long long delta,
+                        int threads)
+{
+    initResult(G, result);
+    if (source >= G.vexnum)
+        return -1;
+
+    // 检查负权，同时求最大权值
+    VRType maxWeight = 1;
+    bool negative = false;
+    if (!G.weight.empty())
+    {
+        atomic<VRType> maxW(1);
+        atomic<bool> neg(false);
+        ParallelFor(threads, G.weight.size(), [&](size_t lo, size_t hi)
+                    {
+            VRType m = 1;
+            bool n = false;
+            for (size_t e = lo; e < hi; e++)
+            {
+                m = max(m, G.weight[e]);
+                n = n || G.weight[e] < 0;
+            }
+            VRType cur = maxW.load();
+            while (m > cur && !maxW.compare_exchange_weak(cur, m))
+            {
+            }
+            if (n)
+                neg = true; });
+        maxWeight = maxW;
+        negative = neg;
+    }
+    if (negative)
+        return -1;
+    if (delta <= 0)
+    {
+        EdgeId avgDegree = max<EdgeId>(1, G.adj.size() / max<VertexId>(1, G.vexnum));
+        delta = max<long long>(1, maxWeight / static_cast<long long>(avgDegree));
+    }
+    // 桶数ceil(maxWeight / delta) + 1不超过DELTA_MAX_BUCKETS
+    delta = max<long long>(delta, (maxWeight + DELTA_MAX_BUCKETS - 2) / (DELTA_MAX_BUCKETS - 1));
+    size_t slots = static_cast<size_t>((maxWeight + delta - 1) / delta) + 1;
+
+    vector<long long> &dist = result.dist;
+    vector<vector<VertexId>> buckets(slots); // 第k个桶存放在buckets[k % slots]
+    vector<VertexId> frontier, updated;
+    vector<uint32_t> queued(G.vexnum, 0); // 顶点在哪一轮被放入桶中，用于去掉同一轮的重复
+    uint32_t round = 0;
+    size_t pending = 1; // 各桶中的项数（含过期项）
+    dist[source] = 0;
+    buckets[0].push_back(source);
+
+    for (uint64_t b = 0; pending > 0; b++)
+    {
+        vector<VertexId> &bucket = buckets[b % slots];
+        while (!bucket.empty())
+        {
+            frontier.swap(bucket);
+            bucket.clear();
+            pending -= frontier.size();
+
+            // 本轮最多产生frontier出弧数个更新
+            EdgeId arcs = 0;
+            for (VertexId u : frontier)
+                arcs += G.offset[u + 1] - G.offset[u];
+            updated.resize(arcs);
+            atomic<size_t> size(0);
+            ParallelFor(threads, frontier.size(), [&](size_t lo, size_t hi)
+                        {
+                vector<VertexId> local;
+                for (size_t k = lo; k < hi; k++)
+                {
+                    VertexId u = frontier[k];
+                    long long du = __atomic_load_n(&dist[u], __ATOMIC_RELAXED);
+                    if (static_cast<uint64_t>(du / delta) != b)
+                        continue; // 过期项
+                    for (EdgeId e = G.offset[u]; e < G.offset[u + 1]; e++)
+                        if (atomicMin(dist[G.adj[e]], du + ArcWeight(G, e)))
+                            local.push_back(G.adj[e]);
+                }
+                size_t pos = size.fetch_add(local.size());
+                copy(local.begin(), local.end(), updated.begin() + pos); });
+
+            round++;
+            for (size_t k = 0; k < size; k++)
+            {
+                VertexId v = updated[k];
+                if (queued[v] == round)
+                    continue;
+                queued[v] = round;
+                buckets[static_cast<uint64_t>(dist[v] / delta) % slots].push_back(v);
+                pending++;
+            }
+        }
+    }
+
+    buildPredecessors(G, source, result, threads);
+    return 1;
+}
+
+/**
+ * 批量求多个源点的单源最短路径
+ * @param G CSR图
+ * @param sources 源点
+ * @param results 与sources一一对应的结果
+ * @param threads 线程数，0表示使用硬件并发数
+ * @return 全部成功返回1，有源点越界或负权弧返回-1
+ *
+ * 算法实现:
+ * 1. 各源点之间没有依赖，并行地为每个源点运行一次基于基数堆的Dijkstra，每个线程使用自己的堆。
+ * 2. 源点很多时比对每个源点做并行Δ-stepping更好：没有同步开销，所有线程始终满载。
+ */
+Status CSRMultiSourceShortestPaths(const CSRGraph &G, const vector<VertexId> &sources,
+                                   vector<CSRShortestPathResult> &results, int threads)
+{
+    results.resize(sources.size());
+    atomic<bool> ok(true);
+    ParallelFor(threads, sources.size(), [&](size_t lo, size_t hi)
+                {
+        for (size_t k = lo; k < hi; k++)
+            if (CSRDijkstra(G, sources[k], results[k]) != 1)
+                ok = false; });
+    return ok ? 1 : -1;
+}
@@ -0,0 +1,92 @@
+// CSRSpanTree.cpp
+#include "CSRGraph.h"
+#include "CSRHeap.h"
+#include "UnionFind.h"
+#include <algorithm>
+#include <tuple>
+using namespace std;
+
+/**
+ * Prim算法求最小生成树（图不连通时求最小生成森林）
+ * @param G CSR无向网
+ * @param root 起始顶点
+ * @param tree 生成树的边，按加入次序排列
+ * @return 生成树的总权值
+ *
+ * 算法实现:
+ * 1. 用按顶点索引的4叉堆代替closedge数组：堆中是尚未加入树的顶点，关键字为它到树的最短边（lowcost）。
+ * 2. 弹出关键字最小的顶点v，把(adjvex[v], v)加入树；扫描v的出弧，对更短的边执行decrease-key并更新adjvex。
+ * 3. 每个顶点只在堆中出现一次，堆大小O(V)，总复杂度O(E log V)。
+ * 4. 堆空后从下一个未加入的顶点重新开始，得到森林。
+ */
+long long CSRPrim(const CSRGraph &G, VertexId root, vector<CSRArc> &tree)
+{
+    tree.clear();
+    if (G.vexnum == 0)
+        return 0;
+    vector<bool> inTree(G.vexnum, false);
+    vector<VertexId> adjvex(G.vexnum, CSR_NO_VERTEX);
+    IndexedHeap<VRType> heap(G.vexnum);
+    long long total = 0;
+    for (VertexId k = 0; k < G.vexnum; k++)
+    {
+        VertexId s = (root + k) % G.vexnum;
+        if (inTree[s])
+            continue;
+        heap.pushOrDecrease(s, 0);
+        while (!heap.empty())
+        {
+            VertexId v = heap.pop();
+            inTree[v] = true;
+            if (adjvex[v] != CSR_NO_VERTEX)
+            {
+                VRType w = heap.key(v);
+                tree.push_back(CSRArc{adjvex[v], v, w});
+                total += w;
+            }
+            for (EdgeId e = G.offset[v]; e < G.offset[v + 1]; e++)
+            {
+                VertexId x = G.adj[e];
+                if (!inTree[x] && heap.pushOrDecrease(x, ArcWeight(G, e)))
+                    adjvex[x] = v;
+            }
+        }
+    }
+    return total;
+}
+
+/**
+ * Kruskal算法求最小生成树（图不连通时求最小生成森林）
+ * @param G CSR无向网
+ * @param tree 生成树的边，按权值非递减排列
+ * @return 生成树的总权值
+ *
+ * 算法实现:
+ * 1. 每条无向边在CSR中存了两次，只取u < v的一份，自环丢弃，按(权值, u, v)排序。
+ * 2. 依次检查各边，用并查集（路径减半、按大小合并）判断两端是否已连通，不连通则加入树。
+ * 3. 并查集中只剩一个集合时提前结束。
+ */
+long long CSRKruskal(const CSRGraph &G, vector<CSRArc> &tree)
+{
+    tree.clear();
+    vector<CSRArc> edges;
+    for (VertexId u = 0; u < G.vexnum; u++)
+        for (EdgeId e = G.offset[u]; e < G.offset[u + 1]; e++)
+            if (u < G.adj[e] || (IsDirected(G) && u != G.adj[e]))
+                edges.push_back(CSRArc{u, G.adj[e], ArcWeight(G, e)});
+    sort(edges.begin(), edges.end(), [](const CSRArc &a, const CSRArc &b)
+         { return tie(a.weight, a.from, a.to) < tie(b.weight, b.from, b.to); });
+
+    UnionFind uf(G.vexnum);
+    long long total = 0;
+    for (const CSRArc &a : edges)
+    {
+        if (uf.count() <= 1)
+            break;
+        if (!uf.unite(a.from, a.to))
+            continue;
+        tree.push_back(a);
+        total += a.weight;
+    }
+    return total;
+}
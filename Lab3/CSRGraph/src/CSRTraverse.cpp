@@ -0,0 +1,83 @@
+// CSRTraverse.cpp
+#include "CSRGraph.h"
+#include <utility>
+using namespace std;
+
+/**
+ * 深度优先遍历，覆盖所有连通分量
+ * @param G CSR图
+ * @param order 访问序列
+ *
+ * 算法实现:
+ * 1. 用显式栈代替递归，栈中保存(顶点, 下一条待检查的弧)，顶点数很大时不会栈溢出。
+ * 2. 每次从栈顶顶点的下一条弧继续，遇到未访问的邻接点即访问并入栈，访问次序与递归版本相同。
+ * 3. 栈顶顶点的弧检查完毕后出栈。
+ */
+void CSRDFSTraverse(const CSRGraph &G, vector<VertexId> &order)
+{
+    order.clear();
+    order.reserve(G.vexnum);
+    vector<bool> visited(G.vexnum, false);
+    vector<pair<VertexId, EdgeId>> stack;
+    for (VertexId s = 0; s < G.vexnum; s++)
+    {
+        if (visited[s])
+            continue;
+        visited[s] = true;
+        order.push_back(s);
+        stack.push_back(make_pair(s, G.offset[s]));
+        while (!stack.empty())
+        {
+            VertexId v = stack.back().first;
+            EdgeId &e = stack.back().second;
+            while (e < G.offset[v + 1] && visited[G.adj[e]])
+                e++;
+            if (e == G.offset[v + 1])
+            {
+                stack.pop_back();
+                continue;
+            }
+            VertexId w = G.adj[e++];
+            visited[w] = true;
+            order.push_back(w);
+            stack.push_back(make_pair(w, G.offset[w]));
+        }
+    }
+}
+
+/**
+ * 广度优先遍历，覆盖所有连通分量
+ * @param G CSR图
+ * @param order 访问序列
+ *
+ * 算法实现:
+ * 1. 访问序列本身就是队列：队头下标之前的顶点已处理完毕，入队即追加到序列末尾。
+ * 2. 每个顶点入队时标记为已访问，保证只入队一次。
+ */
+void CSRBFSTraverse(const CSRGraph &G, vector<VertexId> &order)
+{
+    order.clear();
+    order.reserve(G.vexnum);
+    vector<bool> visited(G.vexnum, false);
+    size_t head = 0;
+    for (VertexId s = 0; s < G.vexnum; s++)
+    {
+        if (visited[s])
+            continue;
+        visited[s] = true;
+        order.push_back(s);
+        while (head < order.size())
+        {
+            VertexId v = order[head++];
+            for (EdgeId e = G.offset[v]; e < G.offset[v + 1]; e++)
+            {
+                VertexId w = G.adj[e];
+                if (!visited[w])
+                {
+                    visited[w] = true;
+                    order.push_back(w);
+                }
+            }
+        }
+    }
+}
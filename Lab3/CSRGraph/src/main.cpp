@@ -0,0 +1,260 @@
+// main.cpp
+#include "CSRGraph.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+using namespace std;
+
+// 输出顶点序列，顶点用名称表示
+static void outOrder(const CSRGraph &G, const vector<VertexId> &order)
+{
+    for (VertexId v : order)
+        cout << G.vexs[v] << " ";
+    cout << endl;
+}
+
+// 输出生成树的边
+static void outTree(const CSRGraph &G, const vector<CSRArc> &tree, long long total)
+{
+    for (const CSRArc &a : tree)
+        cout << "(" << G.vexs[a.from] << ", " << G.vexs[a.to] << ", " << a.weight << ") ";
+    cout << endl
+         << "总权值: " << total << endl;
+}
+
+// (1) 四种图的创建与度（与Mgraph的示例相同）
+static void demoDegree()
+{
+    GraphKind kinds[4] = {DG, DN, UDG, UDN};
+    const char *kind_names[4] = {"有向图", "有向网", "无向图", "无向网"};
+    char vexs[] = {'A', 'B', 'C', 'D'};
+    int arcs[4][12] = {
+        {0, 1, 1, 0, 2, 1, 1, 3, 1, 2, 3, 1},
+        {0, 1, 5, 0, 2, 3, 1, 3, 2, 2, 3, 4},
+        {0, 1, 1, 0, 2, 1, 1, 3, 1, 2, 3, 1},
+        {0, 1, 5, 0, 2, 3, 1, 3, 2, 2, 3, 4}};
+
+    for (int k = 0; k < 4; k++)
+    {
+        CSRGraph G;
+        cout << "创建 " << kind_names[k] << " ..." << endl;
+        CreateCSRGraph(kinds[k], G, 4, 4, vexs, arcs[k]);
+        OutCSRGraph(G);
+
+        vector<EdgeId> in, out;
+        CSRVerDegree(G, in, out);
+        for (VertexId v = 0; v < G.vexnum; v++)
+        {
+            if (IsDirected(G))
+                cout << G.vexs[v] << ": 入度 " << in[v] << ", 出度 " << out[v] << endl;
+            else
+                cout << G.vexs[v] << ": 度 " << out[v] << endl;
+        }
+        cout << "-----------------------------" << endl;
+    }
+}
+
+// (2) 遍历（与遍历图的示例相同）
+static void demoTraverse()
+{
+    char vexs[] = {'0', '1', '2', '3', '4', '5'};
+    int arcs[] = {0, 1, 1, 0, 2, 1, 1, 3, 1, 1, 4, 1, 2, 5, 1, 3, 4, 1, 4, 5, 1};
+    CSRGraph G;
+    CreateCSRGraph(UDG, G, 6, 7, vexs, arcs);
+    OutCSRGraph(G);
+
+    vector<VertexId> order;
+    CSRDFSTraverse(G, order);
+    cout << "深度优先遍历: ";
+    outOrder(G, order);
+    CSRBFSTraverse(G, order);
+    cout << "广度优先遍历: ";
+    outOrder(G, order);
+
+    vector<VertexId> comp;
+    cout << "连通分量个数: " << CSRConnectedComponents(G, comp) << endl;
+}
+
+// (3) 最小生成树（与最小生成树的示例相同）
+static void demoSpanTree()
+{
+    char vexs[] = {'A', 'B', 'C', 'D', 'E', 'F'};
+    int arcs[] = {0, 1, 10, 0, 2, 12, 0, 4, 15, 1, 2, 7, 1, 3, 5,
+                  1, 5, 6, 2, 4, 12, 2, 5, 8, 3, 5, 6, 4, 5, 10};
+    CSRGraph G;
+    CreateCSRGraph(UDN, G, 6, 10, vexs, arcs);
+
+    vector<CSRArc> tree;
+    long long total = CSRPrim(G, 0, tree);
+    cout << "Prim: ";
+    outTree(G, tree, total);
+    total = CSRKruskal(G, tree);
+    cout << "Kruskal: ";
+    outTree(G, tree, total);
+    total = CSRFilterKruskal(G, tree);
+    cout << "Filter-Kruskal: ";
+    outTree(G, tree, total);
+    total = CSRBoruvka(G, tree);
+    cout << "Borůvka: ";
+    outTree(G, tree, total);
+}
+
+// (4) 关键路径（与关键路径的示例相同）
+static void demoCriticalPath()
+{
+    char vexs[] = {'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J'};
+    int arcs[] = {0, 1, 8, 0, 2, 6, 0, 4, 7, 1, 3, 3, 2, 3, 10,
+                  2, 6, 9, 4, 6, 9, 4, 7, 13, 3, 5, 4, 3, 8, 19,
+                  6, 7, 2, 6, 8, 8, 7, 8, 6, 5, 9, 14, 8, 9, 10};
+    CSRGraph G;
+    CreateCSRGraph(DN, G, 10, 15, vexs, arcs);
+
+    CSRCriticalPathResult r;
+    if (!CSRCriticalPath(G, r))
+    {
+        cout << "网中有环" << endl;
+        return;
+    }
+    cout << "事件  ve  vl" << endl;
+    for (VertexId v : r.topo)
+        cout << G.vexs[v] << "     " << r.ve[v] << "   " << r.vl[v] << endl;
+    cout << "关键活动: ";
+    for (const CSRArc &a : r.critical)
+        cout << G.vexs[a.from] << "->" << G.vexs[a.to] << "(" << a.weight << ") ";
+    cout << endl
+         << "工期: " << r.length << endl;
+}
+
+// (5) 最短路径（严蔚敏《数据结构》图7.34的有向网）
+static void demoShortestPath()
+{
+    char vexs[] = {'0', '1', '2', '3', '4', '5'};
+    int arcs[] = {0, 2, 10, 0, 4, 30, 0, 5, 100, 1, 2, 5, 2, 3, 50, 3, 5, 10, 4, 3, 20, 4, 5, 60};
+    CSRGraph G;
+    CreateCSRGraph(DN, G, 6, 8, vexs, arcs);
+
+    CSRShortestPathResult r, d;
+    CSRDijkstra(G, 0, r);
+    CSRDeltaStepping(G, 0, d);
+    for (VertexId v = 0; v < G.vexnum; v++)
+    {
+        cout << G.vexs[0] << " -> " << G.vexs[v] << ": ";
+        if (r.dist[v] == CSR_NO_PATH)
+        {
+            cout << "不可达" << endl;
+            continue;
+        }
+        vector<VertexId> path;
+        for (VertexId x = v; x != 0; x = r.pred[x])
+            path.push_back(x);
+        path.push_back(0);
+        reverse(path.begin(), path.end());
+        cout << r.dist[v] << "（Δ-stepping " << d.dist[v] << "）路径 ";
+        outOrder(G, path);
+    }
+
+    // 权值远大于桶宽：桶数组循环使用，不随最大距离增长
+    char bigVexs[] = {'a', 'b'};
+    int bigArcs[] = {0, 1, 1000000000};
+    CSRGraph B;
+    CreateCSRGraph(DN, B, 2, 1, bigVexs, bigArcs);
+    CSRShortestPathResult br;
+    CSRDeltaStepping(B, 0, br, 1);
+    cout << "a -> b（权值1e9，delta=1）: " << br.dist[1] << endl;
+}
+
+// (6) 大规模随机图的构造（顶点数远超MAX_VERTEX_NUM）
+static void demoLarge()
+{
+    const VertexId n = 1000000;
+    const size_t m = 8000000;
+    vector<VertexId> from(m), to(m);
+    vector<VRType> w(m);
+    uint64_t s = 88172645463325252ull;
+    for (size_t k = 0; k < m; k++)
+    {
+        s ^= s << 13;
+        s ^= s >> 7;
+        s ^= s << 17;
+        from[k] = static_cast<VertexId>(s % n);
+        to[k] = static_cast<VertexId>((s >> 32) % n);
+        w[k] = static_cast<VRType>(s >> 54) + 1;
+    }
+
+    CSRGraph G;
+    auto t0 = chrono::steady_clock::now();
+    CreateCSRGraph(DN, G, n, from, to, w);
+    auto t1 = chrono::steady_clock::now();
+    BuildCSRReverse(G);
+    auto t2 = chrono::steady_clock::now();
+    vector<VertexId> order;
+    CSRBFSTraverse(G, order);
+    auto t3 = chrono::steady_clock::now();
+
+    CSRBFSResult r;
+    CSRParallelBFS(G, 0, r);
+    auto t4 = chrono::steady_clock::now();
+    vector<VertexId> comp;
+    VertexId components = CSRConnectedComponents(G, comp);
+    auto t5 = chrono::steady_clock::now();
+    VertexId depth = 0;
+    for (VertexId v = 0; v < n; v++)
+        if (r.level[v] != CSR_NO_VERTEX)
+            depth = max(depth, r.level[v]);
+
+    auto ms = [](chrono::steady_clock::time_point a, chrono::steady_clock::time_point b)
+    { return chrono::duration<double, milli>(b - a).count(); };
+    cout << "顶点数 " << n << ", 弧数 " << m << endl;
+    cout << "构造: " << ms(t0, t1) << " ms, 入弧: " << ms(t1, t2) << " ms, 广度优先遍历: " << ms(t2, t3) << " ms"
+         << endl;
+    cout << "方向优化的并行BFS: " << ms(t3, t4) << " ms, 从顶点0到达 " << r.reached << " 个顶点, 最大层数 " << depth
+         << endl;
+    cout << "并行弱连通分量: " << ms(t4, t5) << " ms, 共 " << components << " 个" << endl;
+
+    // 同一组边作为无向网求最小生成森林
+    CSRGraph U;
+    CreateCSRGraph(UDN, U, n, from, to, w);
+    vector<CSRArc> tree;
+    auto t6 = chrono::steady_clock::now();
+    long long total = CSRPrim(U, 0, tree);
+    auto t7 = chrono::steady_clock::now();
+    cout << "Prim（4叉堆）: " << ms(t6, t7) << " ms, " << tree.size() << " 条边, 总权值 " << total << endl;
+
+    // 有向网上的单源最短路径
+    CSRShortestPathResult sp, ds;
+    auto t8 = chrono::steady_clock::now();
+    CSRDijkstra(G, 0, sp);
+    auto t9 = chrono::steady_clock::now();
+    CSRDeltaStepping(G, 0, ds);
+    auto t10 = chrono::steady_clock::now();
+    vector<VertexId> sources = {0, 1, 2, 3};
+    vector<CSRShortestPathResult> multi;
+    CSRMultiSourceShortestPaths(G, sources, multi);
+    auto t11 = chrono::steady_clock::now();
+    long long farthest = 0;
+    for (VertexId v = 0; v < n; v++)
+        if (sp.dist[v] != CSR_NO_PATH)
+            farthest = max(farthest, sp.dist[v]);
+    cout << "Dijkstra（基数堆）: " << ms(t8, t9) << " ms, 最远距离 " << farthest << endl;
+    cout << "并行Δ-stepping: " << ms(t9, t10) << " ms, 与Dijkstra" << (ds.dist == sp.dist ? "一致" : "不一致") << endl;
+    cout << sources.size() << " 个源点的批量最短路径: " << ms(t10, t11) << " ms, 源点0的结果与Dijkstra"
+         << (multi[0].dist == sp.dist ? "一致" : "不一致") << endl;
+}
+
+int main()
+{
+    cout << "=== (1) 创建与度 ===" << endl;
+    demoDegree();
+    cout << "=== (2) 遍历 ===" << endl;
+    demoTraverse();
+    cout << "=== (3) 最小生成树 ===" << endl;
+    demoSpanTree();
+    cout << "=== (4) 关键路径 ===" << endl;
+    demoCriticalPath();
+    cout << "=== (5) 最短路径 ===" << endl;
+    demoShortestPath();
+    cout << "=== (6) 大规模图 ===" << endl;
+    demoLarge();
+    return 0;
+}
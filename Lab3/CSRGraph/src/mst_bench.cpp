@@ -0,0 +1,247 @@
+// mst_bench.cpp
+#include "CSRGraph.h"
+#include "CSRParallel.h"
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+using namespace std;
+
+// 固定种子的xorshift64*生成器，图在任何平台上都相同
+struct BenchRng
+{
+    uint64_t s;
+    explicit BenchRng(uint64_t seed) : s(seed) {}
+    uint64_t next()
+    {
+        s ^= s >> 12;
+        s ^= s << 25;
+        s ^= s >> 27;
+        return s * 0x2545F4914F6CDD1DULL;
+    }
+};
+
+// 当前的常驻内存，单位KB
+static long currentRssKb()
+{
+    long pages = 0, resident = 0;
+    FILE *f = fopen("/proc/self/statm", "r");
+    if (f)
+    {
+        if (fscanf(f, "%ld %ld", &pages, &resident) != 2)
+            resident = 0;
+        fclose(f);
+    }
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+/**
+ * 在子进程中运行一项测量，求这一项自身使用的峰值常驻内存
+ * @param f 测量函数，返回值经管道传回，须可按字节复制
+ * @param result f的返回值
+ * @param peakKb 子进程的峰值常驻内存减去fork时继承的常驻内存（图等），单位KB
+ * @return 子进程正常结束并传回结果时返回true
+ *
+ * 算法实现:
+ * 1. 进程级的ru_maxrss只增不减，先运行的算法会掩盖后运行的算法；每种算法放在新fork的子进程中运行。
+ * 2. 子进程先记下继承来的常驻内存，与结果一起传回；父进程用wait4取该子进程的ru_maxrss，减去这部分。
+ */
+template <class T, class F>
+static bool runIsolated(F f, T &result, long &peakKb)
+{
+    int fd[2];
+    if (pipe(fd) != 0)
+        return false;
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        close(fd[0]);
+        close(fd[1]);
+        return false;
+    }
+    if (pid == 0)
+    {
+        close(fd[0]);
+        long base = currentRssKb();
+        T r = f();
+        bool sent = write(fd[1], &base, sizeof(base)) == static_cast<ssize_t>(sizeof(base)) &&
+                    write(fd[1], &r, sizeof(r)) == static_cast<ssize_t>(sizeof(r));
+        _exit(sent ? 0 : 1);
+    }
+    close(fd[1]);
+    long base = 0;
+    bool got = read(fd[0], &base, sizeof(base)) == static_cast<ssize_t>(sizeof(base)) &&
+               read(fd[0], &result, sizeof(result)) == static_cast<ssize_t>(sizeof(result));
+    close(fd[0]);
+    int status = 0;
+    struct rusage ru;
+    if (wait4(pid, &status, 0, &ru) != pid)
+        return false;
+    peakKb = max(0L, ru.ru_maxrss - base);
+    return got && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+static double timeIt(const function<void()> &fn)
+{
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+// 随机图：平均度为16，权值在[1, 1000000]中均匀分布
+static void genRandom(size_t m, VertexId &n, vector<VertexId> &from, vector<VertexId> &to, vector<VRType> &w)
+{
+    BenchRng rng(1);
+    n = static_cast<VertexId>(max<size_t>(2, m / 8));
+    from.resize(m);
+    to.resize(m);
+    w.resize(m);
+    for (size_t k = 0; k < m; k++)
+    {
+        uint64_t r = rng.next();
+        from[k] = static_cast<VertexId>((r >> 32) % n);
+        to[k] = static_cast<VertexId>((r & 0xffffffffu) % n);
+        w[k] = static_cast<VRType>(rng.next() % 1000000) + 1;
+    }
+}
+
+// 网格图：side × side的二维网格，每个顶点连向右边和下边的邻居，约2·side²条边
+static void genGrid(size_t m, VertexId &n, vector<VertexId> &from, vector<VertexId> &to, vector<VRType> &w)
+{
+    BenchRng rng(2);
+    VertexId side = static_cast<VertexId>(max(2.0, sqrt(m / 2.0)));
+    n = side * side;
+    from.clear();
+    to.clear();
+    w.clear();
+    for (VertexId r = 0; r < side; r++)
+    {
+        for (VertexId c = 0; c < side; c++)
+        {
+            VertexId v = r * side + c;
+            if (c + 1 < side)
+            {
+                from.push_back(v);
+                to.push_back(v + 1);
+                w.push_back(static_cast<VRType>(rng.next() % 1000000) + 1);
+            }
+            if (r + 1 < side)
+            {
+                from.push_back(v);
+                to.push_back(v + side);
+                w.push_back(static_cast<VRType>(rng.next() % 1000000) + 1);
+            }
+        }
+    }
+}
+
+/**
+ * 在一个图上运行各种最小生成树算法，总权值与Kruskal不一致时ok为false
+ * @param name 图的名称
+ * @param G CSR无向网
+ * @param threads 线程数
+ * @param rounds 每种算法运行的轮数，取最快一次
+ * @return 全部一致返回true
+ */
+static bool benchGraph(const char *name, const CSRGraph &G, int threads, int rounds)
+{
+    struct
+    {
+        const char *name;
+        int threads;
+        function<long long(vector<CSRArc> &)> run;
+    } algos[] = {
+        {"kruskal", 1, [&](vector<CSRArc> &t)
+         { return CSRKruskal(G, t); }},
+        {"filter_kruskal", threads, [&](vector<CSRArc> &t)
+         { return CSRFilterKruskal(G, t, threads); }},
+        {"boruvka", threads, [&](vector<CSRArc> &t)
+         { return CSRBoruvka(G, t, threads); }},
+        {"prim", 1, [&](vector<CSRArc> &t)
+         { return CSRPrim(G, 0, t); }},
+    };
+    long long expect = 0;
+    bool allOk = true;
+    for (auto &a : algos)
+    {
+        struct
+        {
+            double best;
+            size_t edges;
+            long long total;
+        } res = {0, 0, 0};
+        long peak = 0;
+        bool ran = runIsolated([&]()
+                               {
+            vector<CSRArc> tree;
+            long long total = 0;
+            double best = 1e300;
+            for (int r = 0; r < rounds; r++)
+                best = min(best, timeIt([&]()
+                                        { total = a.run(tree); }));
+            decltype(res) out = {best, tree.size(), total};
+            return out; }, res, peak);
+        if (&a == &algos[0])
+            expect = res.total;
+        bool ok = ran && res.total == expect;
+        allOk = allOk && ok;
+        printf("{\"graph\":\"%s\",\"algo\":\"%s\",\"vertices\":%u,\"edges\":%llu,\"threads\":%d,\"ms\":%.1f,"
+               "\"tree_edges\":%zu,\"weight\":%lld,\"ok\":%s,\"peak_rss_kb\":%ld}\n",
+               name, a.name, G.vexnum, static_cast<unsigned long long>(G.arcnum), a.threads, res.best, res.edges,
+               res.total, ok ? "true" : "false", peak);
+        fflush(stdout);
+    }
+    return allOk;
+}
+
+/**
+ * 最小生成树基准测试，结果按行输出JSON
+ * 用法: mst_bench [百万条边=10] [线程数=0] [轮数=1]
+ * 例如 mst_bench 100 得到1亿条边的随机图和网格图
+ */
+int main(int argc, char *argv[])
+{
+    size_t m = static_cast<size_t>(argc > 1 ? atof(argv[1]) * 1e6 : 10e6);
+    int threads = CSRThreads(argc > 2 ? atoi(argv[2]) : 0);
+    int rounds = argc > 3 ? max(1, atoi(argv[3])) : 1;
+
+    struct
+    {
+        const char *name;
+        void (*gen)(size_t, VertexId &, vector<VertexId> &, vector<VertexId> &, vector<VRType> &);
+    } graphs[] = {{"random", genRandom}, {"grid", genGrid}};
+
+    for (auto &g : graphs)
+    {
+        // 构造在子进程中计时并测内存，父进程再构造一次供各算法使用
+        CSRGraph G;
+        double build = 0;
+        long peak = 0;
+        {
+            VertexId n;
+            vector<VertexId> from, to;
+            vector<VRType> w;
+            g.gen(m, n, from, to, w);
+            if (!runIsolated([&]()
+                             { return timeIt([&]()
+                                             { CreateCSRGraph(UDN, G, n, from, to, w, threads); }); }, build, peak))
+                return 1;
+            CreateCSRGraph(UDN, G, n, from, to, w, threads);
+        }
+        printf("{\"graph\":\"%s\",\"algo\":\"build\",\"vertices\":%u,\"edges\":%llu,\"threads\":%d,\"ms\":%.1f,"
+               "\"peak_rss_kb\":%ld}\n",
+               g.name, G.vexnum, static_cast<unsigned long long>(G.arcnum), threads, build, peak);
+        if (!benchGraph(g.name, G, threads, rounds))
+        {
+            fprintf(stderr, "校验失败: %s\n", g.name);
+            return 1;
+        }
+    }
+    return 0;
+}
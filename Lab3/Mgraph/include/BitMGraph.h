@@ -0,0 +1,46 @@
+// BitMGraph.h
+#ifndef BITMGRAPH_H
+#define BITMGRAPH_H
+
+#include "MGraph.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define BIT_WORD_BITS 64 // 每个字存放的顶点数
+#define BIT_ROW_ALIGN 4  // 行长度按4个字（256位）对齐，便于AVX2整块处理
+
+// 位压缩的邻接矩阵，只用于无权图（DG、UDG）
+// 第i行占rowWords个64位字，顶点j对应第j / 64个字的第j % 64位；行尾补0
+typedef struct
+{
+    std::vector<VertexType> vexs; // 顶点数组，存放顶点信息
+    std::vector<uint64_t> bits;   // 邻接矩阵，按行连续存放
+    int rowWords;                 // 每行的字数
+    int vexnum, arcnum;           // 图中顶点总数与弧数
+    GraphKind kind;               // 图的种类标志
+} BitMGraph;
+
+// 第i行的起始地址
+inline const uint64_t *BitRow(const BitMGraph &G, int i)
+{
+    return G.bits.data() + static_cast<std::size_t>(i) * G.rowWords;
+}
+
+// 是否存在弧<i, j>
+inline bool BitIsArc(const BitMGraph &G, int i, int j)
+{
+    return (BitRow(G, i)[j / BIT_WORD_BITS] >> (j % BIT_WORD_BITS)) & 1;
+}
+
+// 函数声明
+Status CreateBitMGraph(GraphKind GKind, BitMGraph &G, int vexnum, int arcnum, const char *vexs, const int *arcs);
+Status MGraphToBitMGraph(const MGraph &M, BitMGraph &G);
+void OutBitMGraph(const BitMGraph &G);
+void TransposeBitMGraph(const BitMGraph &G, BitMGraph &T);
+void BitVerDegree(const BitMGraph &G, std::vector<int> &inDegree, std::vector<int> &outDegree);
+void VerDegree(const BitMGraph &G);
+int CommonNeighbors(const BitMGraph &G, int u, int v);
+const char *BitKernelName();
+
+#endif // BITMGRAPH_H
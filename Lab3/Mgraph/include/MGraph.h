@@ -2,8 +2,12 @@
 #ifndef MGGRAPH_H
 #define MGGRAPH_H
 
+#include <climits>
+
 #define INFINITY 32767    // 表示最大值∞
+#define NO_PATH INT_MAX   // 不可达顶点的距离，与表示没有弧的INFINITY区分
 #define MAX_VERTEX_NUM 20 // 最大顶点数
+#define DEGREE_BLOCK 64   // 计算度时的分块大小
 
 typedef int Status;
 
@@ -37,7 +41,9 @@ typedef struct
 
 // 函数声明
 Status CreateMGraph(GraphKind GKind, MGraph &G, int vexnum, int arcnum, char *vexs, int *arcs);
-void OutMGraph(MGraph G);
-void VerDegree(MGraph G);
+void OutMGraph(const MGraph &G);
+void VerDegree(const MGraph &G, int inDegree[], int outDegree[]);
+void VerDegree(const MGraph &G);
+Status ShortestPath_DIJ(const MGraph &G, int v0, int dist[], int pred[]);
 
 #endif // MGGRAPH_H
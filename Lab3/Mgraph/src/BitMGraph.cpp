@@ -0,0 +1,317 @@
+// BitMGraph.cpp
+#include "BitMGraph.h"
+#include <iostream>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BIT_HAVE_X86 1
+#endif
+using namespace std;
+
+// 统计n个字中1的个数
+static int popcountScalar(const uint64_t *a, int n)
+{
+    int c = 0;
+    for (int i = 0; i < n; i++)
+        c += __builtin_popcountll(a[i]);
+    return c;
+}
+
+// 统计a与b按位与之后1的个数
+static int andPopcountScalar(const uint64_t *a, const uint64_t *b, int n)
+{
+    int c = 0;
+    for (int i = 0; i < n; i++)
+        c += __builtin_popcountll(a[i] & b[i]);
+    return c;
+}
+
+#ifdef BIT_HAVE_X86
+/**
+ * 256位向量中每个64位分量的1的个数
+ * @param v 向量
+ * @return 4个64位计数
+ *
+ * 算法实现:
+ * 1. 把每个字节拆成高低两个半字节，用vpshufb查16项的表得到各半字节的1的个数。
+ * 2. 两者相加得到每个字节的计数，再用vpsadbw把每8个字节的计数求和。
+ */
+__attribute__((target("avx2"))) static inline __m256i popcount256(__m256i v)
+{
+    const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                         0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low = _mm256_set1_epi8(0x0f);
+    __m256i lo = _mm256_and_si256(v, low);
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low);
+    __m256i cnt = _mm256_add_epi8(_mm256_shuffle_epi8(lut, lo), _mm256_shuffle_epi8(lut, hi));
+    return _mm256_sad_epu8(cnt, _mm256_setzero_si256());
+}
+
+// 4个64位分量求和
+__attribute__((target("avx2"))) static inline int sum256(__m256i acc)
+{
+    __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    return static_cast<int>(_mm_cvtsi128_si64(s) + _mm_extract_epi64(s, 1));
+}
+
+// n为BIT_ROW_ALIGN的倍数
+__attribute__((target("avx2"))) static int popcountAVX2(const uint64_t *a, int n)
+{
+    __m256i acc = _mm256_setzero_si256();
+    for (int i = 0; i < n; i += BIT_ROW_ALIGN)
+        acc = _mm256_add_epi64(acc, popcount256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i))));
+    return sum256(acc);
+}
+
+__attribute__((target("avx2"))) static int andPopcountAVX2(const uint64_t *a, const uint64_t *b, int n)
+{
+    __m256i acc = _mm256_setzero_si256();
+    for (int i = 0; i < n; i += BIT_ROW_ALIGN)
+    {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+        __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+        acc = _mm256_add_epi64(acc, popcount256(_mm256_and_si256(x, y)));
+    }
+    return sum256(acc);
+}
+#endif
+
+// 运行时检测一次CPU是否支持AVX2
+static bool useAVX2()
+{
+#ifdef BIT_HAVE_X86
+    static const bool ok = __builtin_cpu_supports("avx2");
+    return ok;
+#else
+    return false;
+#endif
+}
+
+static int popcountRow(const uint64_t *a, int n)
+{
+#ifdef BIT_HAVE_X86
+    if (useAVX2())
+        return popcountAVX2(a, n);
+#endif
+    return popcountScalar(a, n);
+}
+
+static int andPopcountRow(const uint64_t *a, const uint64_t *b, int n)
+{
+#ifdef BIT_HAVE_X86
+    if (useAVX2())
+        return andPopcountAVX2(a, b, n);
+#endif
+    return andPopcountScalar(a, b, n);
+}
+
+// 当前使用的计数实现
+const char *BitKernelName()
+{
+    return useAVX2() ? "AVX2" : "scalar";
+}
+
+// 分配全0的矩阵
+static void initBitMGraph(GraphKind GKind, BitMGraph &G, int vexnum, int arcnum)
+{
+    int words = (vexnum + BIT_WORD_BITS - 1) / BIT_WORD_BITS;
+    G.rowWords = (words + BIT_ROW_ALIGN - 1) / BIT_ROW_ALIGN * BIT_ROW_ALIGN;
+    G.vexnum = vexnum;
+    G.arcnum = arcnum;
+    G.kind = GKind;
+    G.bits.assign(static_cast<size_t>(vexnum) * G.rowWords, 0);
+}
+
+static inline void setArc(BitMGraph &G, int i, int j)
+{
+    G.bits[static_cast<size_t>(i) * G.rowWords + j / BIT_WORD_BITS] |= 1ull << (j % BIT_WORD_BITS);
+}
+
+/**
+ * 创建位压缩的邻接矩阵，参数与CreateMGraph一致，顶点数不受MAX_VERTEX_NUM限制
+ * @param GKind 图的类型，只能是DG或UDG
+ * @param G 位压缩的图
+ * @param vexnum 顶点数
+ * @param arcnum 弧数
+ * @param vexs 顶点数组，可为nullptr
+ * @param arcs 弧数组，每条弧为(i, j, w)三元组，w被忽略
+ * @return 成功返回1，图的类型不是无权图或顶点编号越界返回-1
+ */
+Status CreateBitMGraph(GraphKind GKind, BitMGraph &G, int vexnum, int arcnum, const char *vexs, const int *arcs)
+{
+    if ((GKind != DG && GKind != UDG) || vexnum < 0)
+        return -1;
+    for (int k = 0; k < arcnum; k++)
+    {
+        int i = arcs[3 * k], j = arcs[3 * k + 1];
+        if (i < 0 || i >= vexnum || j < 0 || j >= vexnum)
+            return -1;
+    }
+
+    initBitMGraph(GKind, G, vexnum, arcnum);
+    if (vexs)
+        G.vexs.assign(vexs, vexs + vexnum);
+    else
+        G.vexs.clear();
+    for (int k = 0; k < arcnum; k++)
+    {
+        int i = arcs[3 * k], j = arcs[3 * k + 1];
+        setArc(G, i, j);
+        if (GKind == UDG)
+            setArc(G, j, i);
+    }
+    return 1;
+}
+
+/**
+ * 把无权图的邻接矩阵转换为位压缩形式
+ * @param M 邻接矩阵存储的图
+ * @param G 位压缩的图
+ * @return 成功返回1，M不是无权图返回-1
+ */
+Status MGraphToBitMGraph(const MGraph &M, BitMGraph &G)
+{
+    if (M.kind != DG && M.kind != UDG)
+        return -1;
+    initBitMGraph(M.kind, G, M.vexnum, M.arcnum);
+    G.vexs.assign(M.vexs, M.vexs + M.vexnum);
+    for (int i = 0; i < M.vexnum; i++)
+        for (int j = 0; j < M.vexnum; j++)
+            if (M.arcs[i][j].adj > 0 && M.arcs[i][j].adj < INFINITY)
+                setArc(G, i, j);
+    return 1;
+}
+
+// 输出图的邻接矩阵
+void OutBitMGraph(const BitMGraph &G)
+{
+    cout << "顶点数组: ";
+    for (int i = 0; i < G.vexnum; i++)
+    {
+        if (G.vexs.empty())
+            cout << i << " ";
+        else
+            cout << G.vexs[i] << " ";
+    }
+    cout << endl;
+
+    cout << "邻接矩阵:" << endl;
+    for (int i = 0; i < G.vexnum; i++)
+    {
+        for (int j = 0; j < G.vexnum; j++)
+            cout << (BitIsArc(G, i, j) ? "1 " : "0 ");
+        cout << endl;
+    }
+}
+
+/**
+ * 原位转置64×64的位块：a[r]的第c位移到a[c]的第r位
+ * @param a 64个字
+ *
+ * 算法实现:
+ * 1. 把块分成2×2个32×32的子块，交换右上与左下子块。
+ * 2. 对每个子块递归地做同样的交换，子块边长依次为16、8、4、2、1。
+ * 3. 每一层用掩码和移位同时处理一个字中的所有子块，共6层，每层32次交换。
+ */
+static void transpose64(uint64_t a[BIT_WORD_BITS])
+{
+    uint64_t m = 0x00000000ffffffffull;
+    for (int j = 32; j != 0; j >>= 1, m ^= m << j)
+    {
+        for (int k = 0; k < BIT_WORD_BITS; k = ((k | j) + 1) & ~j)
+        {
+            uint64_t t = ((a[k] >> j) ^ a[k | j]) & m;
+            a[k] ^= t << j;
+            a[k | j] ^= t;
+        }
+    }
+}
+
+/**
+ * 分块转置邻接矩阵，得到逆邻接矩阵
+ * @param G 位压缩的图
+ * @param T 转置后的图，T中弧<j, i>对应G中弧<i, j>
+ *
+ * 算法实现:
+ * 1. 把矩阵划分为64×64的位块，块(I, J)由第I块行中各行的第J个字组成。
+ * 2. 读出一个位块，用transpose64在寄存器大小的数组中转置，写到T的块(J, I)。
+ * 3. 每次只处理64个字（512字节），读写都落在L1缓存中，避免逐位转置时按列访问造成的缓存缺失。
+ */
+void TransposeBitMGraph(const BitMGraph &G, BitMGraph &T)
+{
+    initBitMGraph(G.kind, T, G.vexnum, G.arcnum);
+    T.vexs = G.vexs;
+    int blocks = (G.vexnum + BIT_WORD_BITS - 1) / BIT_WORD_BITS;
+    uint64_t a[BIT_WORD_BITS];
+    for (int bi = 0; bi < blocks; bi++)
+    {
+        int rows = min(BIT_WORD_BITS, G.vexnum - bi * BIT_WORD_BITS);
+        for (int bj = 0; bj < blocks; bj++)
+        {
+            int cols = min(BIT_WORD_BITS, G.vexnum - bj * BIT_WORD_BITS);
+            for (int r = 0; r < BIT_WORD_BITS; r++)
+                a[r] = r < rows ? BitRow(G, bi * BIT_WORD_BITS + r)[bj] : 0;
+            transpose64(a);
+            for (int c = 0; c < cols; c++)
+                T.bits[static_cast<size_t>(bj * BIT_WORD_BITS + c) * T.rowWords + bi] = a[c];
+        }
+    }
+}
+
+/**
+ * 计算各顶点的入度和出度
+ * @param G 位压缩的图
+ * @param inDegree 各顶点入度
+ * @param outDegree 各顶点出度
+ *
+ * 算法实现:
+ * 1. 出度为该行中1的个数，支持AVX2时每次统计256位。
+ * 2. 无向图的矩阵对称，入度与出度相同。
+ * 3. 有向图的入度为列中1的个数：先分块转置，再按行统计。
+ */
+void BitVerDegree(const BitMGraph &G, vector<int> &inDegree, vector<int> &outDegree)
+{
+    outDegree.resize(G.vexnum);
+    for (int i = 0; i < G.vexnum; i++)
+        outDegree[i] = popcountRow(BitRow(G, i), G.rowWords);
+    if (G.kind == UDG)
+    {
+        inDegree = outDegree;
+        return;
+    }
+    BitMGraph T;
+    TransposeBitMGraph(G, T);
+    inDegree.resize(G.vexnum);
+    for (int i = 0; i < G.vexnum; i++)
+        inDegree[i] = popcountRow(BitRow(T, i), T.rowWords);
+}
+
+// 输出图中各顶点的度
+void VerDegree(const BitMGraph &G)
+{
+    vector<int> in, out;
+    BitVerDegree(G, in, out);
+    cout << "顶点的度:" << endl;
+    for (int i = 0; i < G.vexnum; i++)
+    {
+        if (G.vexs.empty())
+            cout << i;
+        else
+            cout << G.vexs[i];
+        if (G.kind == DG)
+            cout << ": in-degree = " << in[i] << ", out-degree = " << out[i] << endl;
+        else
+            cout << ": degree = " << out[i] << endl;
+    }
+}
+
+/**
+ * 两个顶点的公共邻接点个数（有向图为公共的出弧终点）
+ * @param G 位压缩的图
+ * @param u 顶点
+ * @param v 顶点
+ * @return 公共邻接点个数
+ */
+int CommonNeighbors(const BitMGraph &G, int u, int v)
+{
+    return andPopcountRow(BitRow(G, u), BitRow(G, v), G.rowWords);
+}
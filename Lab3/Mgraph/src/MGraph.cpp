@@ -2,6 +2,7 @@
 #include "MGraph.h"
 #include <iostream>
 #include <cstring>
+#include <algorithm>
 using namespace std;
 
 // 创建图的邻接矩阵存储结构
@@ -73,7 +74,7 @@ Status CreateMGraph(GraphKind GKind, MGraph &G, int vexnum, int arcnum, char *ve
 }
 
 // 输出图的邻接矩阵
-void OutMGraph(MGraph G)
+void OutMGraph(const MGraph &G)
 {
     cout << "顶点数组: ";
     for (int i = 0; i < G.vexnum; i++)
@@ -100,38 +101,126 @@ void OutMGraph(MGraph G)
     }
 }
 
-// 输出图中各顶点的度
-void VerDegree(MGraph G)
+/**
+ * 计算各顶点的入度和出度，一遍扫描同时得到两者
+ * @param G 图
+ * @param inDegree 各顶点入度，至少vexnum项
+ * @param outDegree 各顶点出度，至少vexnum项；无向图两者相同，都是度
+ *
+ * 算法实现:
+ * 1. 只按行访问矩阵：元素(i, j)是弧时同时给out[i]和in[j]加1，避免按列扫描的跨行访问。
+ * 2. 按DEGREE_BLOCK×DEGREE_BLOCK分块，一块内用到的in[j]和out[i]都留在缓存中。
+ * 3. 判断是否为弧写成无分支的比较，内层循环可以被编译器向量化。
+ */
+void VerDegree(const MGraph &G, int inDegree[], int outDegree[])
 {
-    cout << "顶点的度:" << endl;
-    if (G.kind == DG || G.kind == DN)
+    int n = G.vexnum;
+    for (int i = 0; i < n; i++)
     {
-        // 有向图：计算入度和出度
-        for (int i = 0; i < G.vexnum; i++)
+        inDegree[i] = 0;
+        outDegree[i] = 0;
+    }
+    for (int i0 = 0; i0 < n; i0 += DEGREE_BLOCK)
+    {
+        int i1 = min(n, i0 + DEGREE_BLOCK);
+        for (int j0 = 0; j0 < n; j0 += DEGREE_BLOCK)
         {
-            int in = 0, out = 0;
-            for (int j = 0; j < G.vexnum; j++)
+            int j1 = min(n, j0 + DEGREE_BLOCK);
+            for (int i = i0; i < i1; i++)
             {
-                if (G.arcs[j][i].adj > 0 && G.arcs[j][i].adj < INFINITY)
-                    in++;
-                if (G.arcs[i][j].adj > 0 && G.arcs[i][j].adj < INFINITY)
-                    out++;
+                const ArcCell *row = G.arcs[i];
+                int out = 0;
+                for (int j = j0; j < j1; j++)
+                {
+                    int e = (row[j].adj > 0) & (row[j].adj < INFINITY);
+                    out += e;
+                    inDegree[j] += e;
+                }
+                outDegree[i] += out;
             }
-            cout << G.vexs[i] << ": in-degree = " << in << ", out-degree = " << out << endl;
         }
     }
+}
+
+// 输出图中各顶点的度
+void VerDegree(const MGraph &G)
+{
+    int in[MAX_VERTEX_NUM], out[MAX_VERTEX_NUM];
+    VerDegree(G, in, out);
+    cout << "顶点的度:" << endl;
+    if (G.kind == DG || G.kind == DN)
+    {
+        // 有向图：入度和出度
+        for (int i = 0; i < G.vexnum; i++)
+            cout << G.vexs[i] << ": in-degree = " << in[i] << ", out-degree = " << out[i] << endl;
+    }
     else
     {
         // 无向图：度为相邻边数
         for (int i = 0; i < G.vexnum; i++)
+            cout << G.vexs[i] << ": degree = " << out[i] << endl;
+    }
+}
+
+/**
+ * 迪杰斯特拉算法求单源最短路径，适用于稠密图
+ * @param G 图；无权图每条弧的长度为1，adj为0或INFINITY表示没有弧
+ * @param v0 源点下标
+ * @param dist 各顶点到v0的最短路径长度，不可达为NO_PATH，至少vexnum项；路径长度可以超过INFINITY
+ * @param pred 最短路径上的前驱，v0的前驱是自身，不可达为-1，至少vexnum项
+ * @return 成功返回1；源点越界或有负权弧返回-1
+ *
+ * 算法实现:
+ * 1. 邻接矩阵中每个顶点有n个可能的邻接点，用堆不会更快：每轮顺序扫描dist选出未确定的最近顶点u。
+ * 2. 再顺序扫描矩阵的第u行松弛，两次扫描都是连续访问，没有堆操作和分支预测失败的开销，共O(n^2)。
+ * 3. 稀疏的大图请用CSRGraph中的CSRDijkstra或CSRDeltaStepping。
+ */
+Status ShortestPath_DIJ(const MGraph &G, int v0, int dist[], int pred[])
+{
+    int n = G.vexnum;
+    if (v0 < 0 || v0 >= n)
+        return -1;
+    bool final[MAX_VERTEX_NUM];
+    for (int v = 0; v < n; v++)
+    {
+        dist[v] = NO_PATH;
+        pred[v] = -1;
+        final[v] = false;
+    }
+    dist[v0] = 0;
+    pred[v0] = v0;
+
+    for (int i = 0; i < n; i++)
+    {
+        // 选出未确定的最近顶点
+        int u = -1, best = NO_PATH;
+        for (int v = 0; v < n; v++)
         {
-            int degree = 0;
-            for (int j = 0; j < G.vexnum; j++)
+            if (!final[v] && dist[v] < best)
             {
-                if (G.arcs[i][j].adj > 0 && G.arcs[i][j].adj < INFINITY)
-                    degree++;
+                best = dist[v];
+                u = v;
+            }
+        }
+        if (u == -1)
+            break; // 其余顶点不可达
+        final[u] = true;
+
+        // 松弛第u行
+        const ArcCell *row = G.arcs[u];
+        for (int v = 0; v < n; v++)
+        {
+            int w = row[v].adj;
+            if (w == 0 || w >= INFINITY)
+                continue;
+            if (w < 0)
+                return -1;
+            if (!final[v] && best + w < dist[v])
+            {
+                dist[v] = best + w;
+                pred[v] = u;
             }
-            cout << G.vexs[i] << ": degree = " << degree << endl;
         }
     }
+    return 1;
 }
@@ -1,6 +1,9 @@
 // main.cpp
 #include "MGraph.h"
+#include "BitMGraph.h"
+#include <chrono>
 #include <iostream>
+#include <vector>
 using namespace std;
 
 int main()
@@ -55,7 +58,93 @@ int main()
         cout << "输出各顶点的度:" << endl;
         VerDegree(G);
         cout << "-----------------------------" << endl;
+
+        // 无权图再用位压缩矩阵计算一次
+        if (currentKind == DG || currentKind == UDG)
+        {
+            BitMGraph B;
+            MGraphToBitMGraph(G, B);
+            cout << "位压缩矩阵的度:" << endl;
+            VerDegree(B);
+            cout << "B与C的公共邻接点数: " << CommonNeighbors(B, 1, 2) << endl;
+            cout << "-----------------------------" << endl;
+        }
     }
 
+    // 最短路径：严蔚敏《数据结构》图7.34的有向网
+    {
+        MGraph G;
+        char names[] = {'0', '1', '2', '3', '4', '5'};
+        int arcs[] = {0, 2, 10, 0, 4, 30, 0, 5, 100, 1, 2, 5, 2, 3, 50, 3, 5, 10, 4, 3, 20, 4, 5, 60};
+        CreateMGraph(DN, G, 6, 8, names, arcs);
+        int dist[MAX_VERTEX_NUM], pred[MAX_VERTEX_NUM];
+        ShortestPath_DIJ(G, 0, dist, pred);
+        cout << "从顶点0出发的最短路径:" << endl;
+        for (int v = 0; v < G.vexnum; v++)
+        {
+            if (dist[v] == NO_PATH)
+            {
+                cout << "0 -> " << G.vexs[v] << ": 不可达" << endl;
+                continue;
+            }
+            vector<int> path;
+            for (int x = v; x != 0; x = pred[x])
+                path.push_back(x);
+            cout << "0 -> " << G.vexs[v] << ": " << dist[v] << "，路径 0";
+            for (int k = (int)path.size() - 1; k >= 0; k--)
+                cout << " " << G.vexs[path[k]];
+            cout << endl;
+        }
+
+        // 路径长度超过INFINITY：两条权值20000的弧
+        MGraph L;
+        char longNames[] = {'a', 'b', 'c'};
+        int longArcs[] = {0, 1, 20000, 1, 2, 20000};
+        CreateMGraph(DN, L, 3, 2, longNames, longArcs);
+        ShortestPath_DIJ(L, 0, dist, pred);
+        cout << "a -> c: ";
+        if (dist[2] == NO_PATH)
+            cout << "不可达" << endl;
+        else
+            cout << dist[2] << endl;
+        cout << "-----------------------------" << endl;
+    }
+
+    // 大规模稠密图：位压缩矩阵每个顶点对只占1位
+    int n = 4096;
+    vector<int> arcs;
+    unsigned long long s = 88172645463325252ull;
+    for (int i = 0; i < n; i++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            s ^= s << 13;
+            s ^= s >> 7;
+            s ^= s << 17;
+            if (s % 4 == 0)
+            {
+                arcs.push_back(i);
+                arcs.push_back(j);
+                arcs.push_back(1);
+            }
+        }
+    }
+    BitMGraph B;
+    CreateBitMGraph(DG, B, n, static_cast<int>(arcs.size() / 3), nullptr, arcs.data());
+    cout << "位压缩有向图: " << n << " 个顶点, " << B.arcnum << " 条弧, 矩阵 " << B.bits.size() * 8 / 1024
+         << " KB, 计数实现 " << BitKernelName() << endl;
+
+    auto t0 = chrono::steady_clock::now();
+    vector<int> in, out;
+    BitVerDegree(B, in, out);
+    auto t1 = chrono::steady_clock::now();
+    long long common = 0;
+    for (int u = 0; u < n; u++)
+        common += CommonNeighbors(B, u, (u + 1) % n);
+    auto t2 = chrono::steady_clock::now();
+    cout << "全部顶点的入度和出度: " << chrono::duration<double, milli>(t1 - t0).count() << " ms" << endl;
+    cout << n << " 次公共邻接点计数: " << chrono::duration<double, milli>(t2 - t1).count() << " ms (合计 " << common
+         << ")" << endl;
+
     return 0;
 }
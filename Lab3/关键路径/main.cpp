@@ -1,10 +1,18 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <iostream>
+#include <map>
 #include <queue>
+#include <string>
+#include <thread>
 #include <vector>
 using namespace std;
 
 const int MAX_VERTEX = 20;
 const int INFINITY = 10000;
+const size_t PARALLEL_GRAIN = 2048; // 任务数少于该值时不启动线程，直接在调用线程中执行
 
 // 图的类型枚举
 typedef enum
@@ -26,8 +34,9 @@ struct ArcNode
 // 顶点节点结构
 struct Vertex
 {
-    char name;         // 顶点名称
-    ArcNode *firstArc; // 第一条边
+    char name;           // 顶点名称
+    ArcNode *firstArc;   // 第一条边
+    ArcNode *firstInArc; // 第一条入边（反向邻接表，targetVertex为弧尾）
 
     // 前向传播相关
     int earliestStart; // 最早开始时间
@@ -35,8 +44,55 @@ struct Vertex
 
     // 反向传播相关
     int latestStart; // 最迟开始时间
+    int remaining;   // 到终点的最长路径长度，latestStart = 工期 - remaining（用于增量更新）
 };
 
+// 关键路径分析的结果，下标为顶点编号或弧的编号（输入中的次序）
+struct CPMResult
+{
+    vector<int> earliest;     // 各事件的最早发生时间
+    vector<int> latest;       // 各事件的最迟发生时间
+    vector<int> slack;        // 各活动的时间余量，0表示关键活动
+    vector<int> criticalArcs; // 关键活动的弧编号，从小到大
+    int length;               // 项目总工期
+    int levels;               // 拓扑层数（关键路径上的最多活动数加一）
+    bool acyclic;             // false表示网中有环，其余结果无意义
+};
+
+// 活动持续时间的一次修改
+struct DurationChange
+{
+    int arc;      // 弧的编号（输入中的次序）
+    int duration; // 新的持续时间
+};
+
+// 把[0, n)切成若干段，由threads个线程通过原子游标领取并调用fn(lo, hi)；threads为0时使用硬件并发数
+template <typename F>
+void parallelFor(int threads, size_t n, F fn)
+{
+    if (threads <= 0)
+        threads = max(1u, thread::hardware_concurrency());
+    if (threads == 1 || n < PARALLEL_GRAIN)
+    {
+        if (n > 0)
+            fn((size_t)0, n);
+        return;
+    }
+    size_t grain = max(PARALLEL_GRAIN / 4, n / ((size_t)threads * 8));
+    atomic<size_t> cursor(0);
+    auto worker = [&]()
+    {
+        for (size_t lo = cursor.fetch_add(grain); lo < n; lo = cursor.fetch_add(grain))
+            fn(lo, min(n, lo + grain));
+    };
+    vector<thread> pool;
+    for (int t = 1; t < threads; t++)
+        pool.emplace_back(worker);
+    worker();
+    for (thread &th : pool)
+        th.join();
+}
+
 // 图结构
 class ActivityNetwork
 {
@@ -44,31 +100,48 @@ private:
     vector<Vertex> vertices;
     int vertexCount, arcCount;
     GraphKind kind;
+    vector<ArcNode> arcPool; // 边结点池：前arcCount个是出边，后arcCount个是对应的入边，下标即弧的编号
+    vector<int> topoOrder;   // 前向传播得到的拓扑序列
+
+    // 增量更新相关，由完整的关键路径分析建立
+    vector<int> topoPos;      // 各顶点在拓扑序列中的位置
+    vector<char> critical;    // 各活动是否为关键活动
+    vector<int> criticalList; // 成为过关键活动的弧编号，以critical为准，工期改变时压缩
+    int criticalCount;        // 关键活动个数
+    map<int, int> sinkTimes;  // 终点（无出边的事件）的最早发生时间 -> 终点个数，最大者即工期
+    vector<unsigned> mark;    // 增量传播时标记已入队的顶点，每次传播换一个新的标记值
+    unsigned markValue;
 
 public:
     // 构造函数
-    ActivityNetwork(int vCount) : vertexCount(vCount)
+    ActivityNetwork(int vCount) : vertexCount(vCount), arcCount(0), kind(DN), criticalCount(0), markValue(0)
     {
         vertices.resize(vCount);
         for (auto &vertex : vertices)
         {
             vertex.firstArc = nullptr;
+            vertex.firstInArc = nullptr;
             vertex.earliestStart = 0;
             vertex.latestStart = INFINITY;
+            vertex.remaining = 0;
             vertex.inDegree = 0;
         }
     }
 
-    // 创建活动网络
-    void createNetwork(char *names, int *arcs, int arcCount)
+    // 创建活动网络，names为nullptr时顶点不命名
+    // 出边与入边一次性分配在arcPool中，第i条弧的出边是arcPool[i]，入边是arcPool[arcCount + i]
+    void createNetwork(const char *names, const int *arcs, int arcCount)
     {
+        this->arcCount = arcCount;
+
         // 初始化顶点
         for (int i = 0; i < vertexCount; i++)
         {
-            vertices[i].name = names[i];
+            vertices[i].name = names ? names[i] : '?';
         }
 
         // 创建边并计算入度
+        arcPool.resize(2 * (size_t)arcCount);
         for (int i = 0; i < arcCount; i++)
         {
             int from = arcs[i * 3];
@@ -76,20 +149,32 @@ public:
             int duration = arcs[i * 3 + 2];
 
             // 创建新边
-            ArcNode *newArc = new ArcNode{to, vertices[from].firstArc, duration};
-            vertices[from].firstArc = newArc;
+            arcPool[i] = ArcNode{to, vertices[from].firstArc, duration};
+            vertices[from].firstArc = &arcPool[i];
+
+            // 同时挂到弧头的入边表中，反向传播时直接找到前驱
+            arcPool[arcCount + i] = ArcNode{from, vertices[to].firstInArc, duration};
+            vertices[to].firstInArc = &arcPool[arcCount + i];
 
             // 更新入度
             vertices[to].inDegree++;
         }
     }
 
-    // 前向传播 - 计算最早开始时间
-    void forwardPropagation()
+    // 前向传播 - 计算最早开始时间，并记录拓扑序列
+    // 返回false表示网中有环；trace为true时输出每个顶点的处理过程
+    bool forwardPropagation(bool trace = false)
     {
-        cout << "\n开始前向传播 - 计算最早开始时间：" << endl;
+        if (trace)
+            cout << "\n开始前向传播 - 计算最早开始时间：" << endl;
+        topoOrder.clear();
+        topoOrder.reserve(vertexCount);
         queue<int> zeroInDegree;
         vector<int> inDegree = getInDegrees();
+        for (auto &vertex : vertices)
+        {
+            vertex.earliestStart = 0;
+        }
 
         // 找出所有入度为0的顶点
         for (int i = 0; i < vertexCount; i++)
@@ -105,9 +190,11 @@ public:
         {
             int current = zeroInDegree.front();
             zeroInDegree.pop();
+            topoOrder.push_back(current);
 
-            cout << "处理顶点 " << vertices[current].name
-                 << " 最早开始时间: " << vertices[current].earliestStart << endl;
+            if (trace)
+                cout << "处理顶点 " << vertices[current].name
+                     << " 最早开始时间: " << vertices[current].earliestStart << endl;
 
             // 更新所有后继顶点
             for (ArcNode *arc = vertices[current].firstArc; arc; arc = arc->next)
@@ -125,19 +212,19 @@ public:
                 }
             }
         }
+        return (int)topoOrder.size() == vertexCount;
     }
 
     // 反向传播 - 计算最迟开始时间
-    void backwardPropagation()
+    // 按拓扑序列的逆序处理顶点，此时它的后继都已处理完，最迟开始时间已确定；
+    // 再沿入边表更新各前驱，每条弧只看一次，O(V + E)。须先调用forwardPropagation
+    void backwardPropagation(bool trace = false)
     {
-        cout << "\n开始反向传播 - 计算最迟开始时间：" << endl;
+        if (trace)
+            cout << "\n开始反向传播 - 计算最迟开始时间：" << endl;
 
-        // 找到最大的最早开始时间（项目总工期）
-        int maxEarliestStart = 0;
-        for (const auto &vertex : vertices)
-        {
-            maxEarliestStart = max(maxEarliestStart, vertex.earliestStart);
-        }
+        // 项目总工期
+        int maxEarliestStart = projectLength();
 
         // 初始化所有顶点的最迟开始时间
         for (auto &vertex : vertices)
@@ -145,27 +232,50 @@ public:
             vertex.latestStart = maxEarliestStart;
         }
 
-        // 反向遍历所有顶点（从后向前）
-        for (int i = vertexCount - 1; i >= 0; i--)
+        // 按逆拓扑序处理顶点
+        for (auto it = topoOrder.rbegin(); it != topoOrder.rend(); ++it)
         {
-            cout << "处理顶点 " << vertices[i].name
-                 << " 最迟开始时间: " << vertices[i].latestStart << endl;
+            int i = *it;
+            if (trace)
+                cout << "处理顶点 " << vertices[i].name
+                     << " 最迟开始时间: " << vertices[i].latestStart << endl;
 
             // 更新所有前驱顶点的最迟开始时间
-            for (int j = 0; j < vertexCount; j++)
+            for (ArcNode *arc = vertices[i].firstInArc; arc; arc = arc->next)
             {
-                for (ArcNode *arc = vertices[j].firstArc; arc; arc = arc->next)
-                {
-                    if (arc->targetVertex == i)
-                    {
-                        // 反向更新最迟开始时间（类似于神经网络中的反向传播）
-                        vertices[j].latestStart = min(
-                            vertices[j].latestStart,
-                            vertices[i].latestStart - arc->duration);
-                    }
-                }
+                int j = arc->targetVertex;
+                // 反向更新最迟开始时间（类似于神经网络中的反向传播）
+                vertices[j].latestStart = min(
+                    vertices[j].latestStart,
+                    vertices[i].latestStart - arc->duration);
             }
         }
+        rebuildIncrementalState();
+    }
+
+    // 项目总工期：最大的最早开始时间
+    int projectLength() const
+    {
+        int length = 0;
+        for (const auto &vertex : vertices)
+        {
+            length = max(length, vertex.earliestStart);
+        }
+        return length;
+    }
+
+    // 关键活动的个数（不输出）；第i条弧的弧尾取自它的入边结点
+    int countCriticalActivities() const
+    {
+        int count = 0;
+        for (int i = 0; i < arcCount; i++)
+        {
+            const ArcNode &arc = arcPool[i];
+            int from = arcPool[arcCount + i].targetVertex;
+            count += vertices[from].earliestStart ==
+                     vertices[arc.targetVertex].latestStart - arc.duration;
+        }
+        return count;
     }
 
     // 输出关键路径
@@ -188,22 +298,423 @@ public:
         }
     }
 
-private:
-    // 获取所有顶点的入度
-    vector<int> getInDegrees()
+    /**
+     * 并行的按层同步关键路径分析，不输出
+     * @param result 各事件的最早、最迟发生时间，各活动的时间余量和关键活动
+     * @param threads 线程数，0表示使用硬件并发数
+     * @return 网中无环返回true
+     *
+     * 算法实现:
+     * 1. 入度为0的事件构成第0层。逐层并行扫描本层事件的出边，用CAS做原子max更新后继的最早发生时间，
+     *    再原子地把后继的入度减一，减到0的线程把它放入自己的缓冲区，段结束时一次原子加领取位置并入下一层。
+     *    同一层处理完（线程汇合）后下一层事件的最早发生时间都已确定。
+     * 2. 各层依次拼接即为拓扑序列。反向传播按层逆序并行处理：每个事件从出边的后继拉取最迟发生时间，
+     *    后继都在更靠后的层中、已经确定，每个事件只由一个线程写，不需要原子操作。
+     * 3. 并行计算每个活动的时间余量 = 弧头的最迟发生时间 - 持续时间 - 弧尾的最早发生时间，余量为0的是关键活动。
+     * 结果同时写回各顶点和拓扑序列，之后可以调用findCriticalPath输出。
+     */
+    bool parallelCriticalPath(CPMResult &result, int threads = 0)
     {
-        vector<int> inDegree(vertexCount, 0);
+        vector<int> inDegree = getInDegrees();
+        vector<int> order(vertexCount);
+        vector<size_t> levelStart(1, 0);
+        size_t size = 0;
         for (int i = 0; i < vertexCount; i++)
         {
-            for (ArcNode *arc = vertices[i].firstArc; arc; arc = arc->next)
+            vertices[i].earliestStart = 0;
+            if (inDegree[i] == 0)
+                order[size++] = i;
+        }
+        levelStart.push_back(size);
+
+        // 前向传播：逐层扩展
+        while (levelStart[levelStart.size() - 2] < levelStart.back())
+        {
+            size_t lo = levelStart[levelStart.size() - 2], hi = levelStart.back();
+            atomic<size_t> tail(hi);
+            parallelFor(threads, hi - lo, [&](size_t a, size_t b)
+                        {
+                vector<int> local;
+                for (size_t k = lo + a; k < lo + b; k++)
+                {
+                    int current = order[k];
+                    int es = vertices[current].earliestStart;
+                    for (ArcNode *arc = vertices[current].firstArc; arc; arc = arc->next)
+                    {
+                        int next = arc->targetVertex;
+                        atomicMax(vertices[next].earliestStart, es + arc->duration);
+                        if (__atomic_sub_fetch(&inDegree[next], 1, __ATOMIC_ACQ_REL) == 0)
+                            local.push_back(next);
+                    }
+                }
+                size_t pos = tail.fetch_add(local.size());
+                copy(local.begin(), local.end(), order.begin() + pos); });
+            levelStart.push_back(tail);
+        }
+        levelStart.pop_back();
+
+        result.levels = (int)levelStart.size() - 1;
+        result.acyclic = levelStart.back() == (size_t)vertexCount;
+        if (!result.acyclic)
+            return false;
+        topoOrder = order;
+
+        result.length = 0;
+        for (const auto &vertex : vertices)
+            result.length = max(result.length, vertex.earliestStart);
+
+        // 反向传播：按层逆序，每个事件从后继拉取
+        for (int l = result.levels - 1; l >= 0; l--)
+        {
+            size_t lo = levelStart[l], hi = levelStart[l + 1];
+            parallelFor(threads, hi - lo, [&](size_t a, size_t b)
+                        {
+                for (size_t k = lo + a; k < lo + b; k++)
+                {
+                    int current = order[k];
+                    int ls = result.length;
+                    for (ArcNode *arc = vertices[current].firstArc; arc; arc = arc->next)
+                        ls = min(ls, vertices[arc->targetVertex].latestStart - arc->duration);
+                    vertices[current].latestStart = ls;
+                } });
+        }
+
+        // 各活动的时间余量
+        result.earliest.resize(vertexCount);
+        result.latest.resize(vertexCount);
+        result.slack.resize(arcCount);
+        parallelFor(threads, vertexCount, [&](size_t a, size_t b)
+                    {
+            for (size_t i = a; i < b; i++)
+            {
+                result.earliest[i] = vertices[i].earliestStart;
+                result.latest[i] = vertices[i].latestStart;
+            } });
+        parallelFor(threads, arcCount, [&](size_t a, size_t b)
+                    {
+            for (size_t i = a; i < b; i++)
+            {
+                int from = arcPool[arcCount + i].targetVertex, to = arcPool[i].targetVertex;
+                result.slack[i] = vertices[to].latestStart - arcPool[i].duration - vertices[from].earliestStart;
+            } });
+        result.criticalArcs.clear();
+        for (int i = 0; i < arcCount; i++)
+        {
+            if (result.slack[i] == 0)
+                result.criticalArcs.push_back(i);
+        }
+        rebuildIncrementalState();
+        return true;
+    }
+
+    /**
+     * 增量更新一批活动的持续时间，只重算受影响的事件
+     * @param changes 修改的活动和新的持续时间
+     * @param changedCritical 返回关键与否发生变化的弧编号（从小到大），用isCriticalArc查询现在的状态
+     * @return 尚未做过完整的关键路径分析或弧编号越界时返回false，网络不变
+     *
+     * 算法实现:
+     * 1. 修改的弧的弧头进入按拓扑位置排序的小顶堆，依次弹出并由入边重算最早发生时间；
+     *    值改变时后继入堆。前驱的拓扑位置更小，弹出时已经确定，只有前向影响锥中的事件被重算。
+     * 2. 对称地，弧尾进入大顶堆，由出边重算到终点的最长路径长度remaining，值改变时前驱入堆。
+     * 3. 工期取终点最早发生时间的最大值，由有序表维护。活动(u, v)为关键活动当且仅当
+     *    ve(u) + 持续时间 + remaining(v) = 工期；工期不变时只需检查两端发生变化的弧。
+     * 4. 工期改变时所有事件的最迟发生时间都要平移，此时O(V)扫描一遍重写并重新找出关键活动，仍不需要拓扑排序。
+     */
+    bool updateDurations(const vector<DurationChange> &changes, vector<int> &changedCritical)
+    {
+        changedCritical.clear();
+        if ((int)topoPos.size() != vertexCount || (int)critical.size() != arcCount)
+            return false;
+        for (const DurationChange &c : changes)
+        {
+            if (c.arc < 0 || c.arc >= arcCount)
+                return false;
+        }
+
+        int oldLength = sinkTimes.empty() ? 0 : sinkTimes.rbegin()->first;
+        vector<int> candidates; // 可能改变关键与否的弧
+        for (const DurationChange &c : changes)
+        {
+            arcPool[c.arc].duration = c.duration;
+            arcPool[arcCount + c.arc].duration = c.duration;
+            candidates.push_back(c.arc);
+        }
+
+        // 前向：重算最早发生时间
+        vector<int> esChanged;
+        propagate(changes, true, esChanged);
+        for (int v : esChanged)
+        {
+            for (ArcNode *arc = vertices[v].firstArc; arc; arc = arc->next)
+                candidates.push_back((int)(arc - &arcPool[0]));
+        }
+
+        // 反向：重算到终点的最长路径长度
+        vector<int> remChanged;
+        propagate(changes, false, remChanged);
+        for (int v : remChanged)
+        {
+            for (ArcNode *arc = vertices[v].firstInArc; arc; arc = arc->next)
+                candidates.push_back((int)(arc - &arcPool[arcCount]));
+        }
+
+        int length = sinkTimes.empty() ? 0 : sinkTimes.rbegin()->first;
+        if (length == oldLength)
+        {
+            for (int v : remChanged)
+                vertices[v].latestStart = length - vertices[v].remaining;
+            for (int i : candidates)
+                setCritical(i, isCriticalNow(i, length), changedCritical);
+        }
+        else
+        {
+            // 工期改变：原来的关键活动逐一复查，再从满足ve + remaining = 工期的事件出发找新的关键活动
+            vector<int> old;
+            for (int i : criticalList)
             {
-                inDegree[arc->targetVertex]++;
+                if (critical[i])
+                    old.push_back(i);
             }
+            criticalList.swap(old);
+            for (int i : old)
+                setCritical(i, isCriticalNow(i, length), changedCritical);
+            for (int v = 0; v < vertexCount; v++)
+            {
+                Vertex &vertex = vertices[v];
+                vertex.latestStart = length - vertex.remaining;
+                if (vertex.earliestStart + vertex.remaining != length)
+                    continue;
+                for (ArcNode *arc = vertex.firstArc; arc; arc = arc->next)
+                {
+                    int i = (int)(arc - &arcPool[0]);
+                    setCritical(i, isCriticalNow(i, length), changedCritical);
+                }
+            }
+        }
+
+        // 频繁变化时criticalList中失效的项会累积，超过有效项的两倍时压缩
+        if (criticalList.size() > 2 * (size_t)criticalCount + 64)
+        {
+            vector<int> live;
+            for (int i : criticalList)
+            {
+                if (critical[i])
+                    live.push_back(i);
+            }
+            sort(live.begin(), live.end());
+            live.erase(unique(live.begin(), live.end()), live.end());
+            criticalList.swap(live);
+        }
+
+        sort(changedCritical.begin(), changedCritical.end());
+        changedCritical.erase(unique(changedCritical.begin(), changedCritical.end()), changedCritical.end());
+        return true;
+    }
+
+    // 第i条弧的名称，形如"A -> B"
+    string arcName(int arc) const
+    {
+        return string(1, vertices[arcPool[arcCount + arc].targetVertex].name) + " -> " +
+               vertices[arcPool[arc].targetVertex].name;
+    }
+
+    // 第i条弧是否为关键活动（须先做过完整的关键路径分析）
+    bool isCriticalArc(int arc) const
+    {
+        return critical[arc] != 0;
+    }
+
+private:
+    // 完整分析之后建立增量更新所需的拓扑位置、remaining、终点时间表和关键活动标记
+    void rebuildIncrementalState()
+    {
+        int length = projectLength();
+        topoPos.assign(vertexCount, 0);
+        for (int k = 0; k < (int)topoOrder.size(); k++)
+            topoPos[topoOrder[k]] = k;
+        sinkTimes.clear();
+        for (auto &vertex : vertices)
+        {
+            vertex.remaining = length - vertex.latestStart;
+            if (!vertex.firstArc)
+                sinkTimes[vertex.earliestStart]++;
+        }
+        critical.assign(arcCount, 0);
+        criticalList.clear();
+        criticalCount = 0;
+        for (int i = 0; i < arcCount; i++)
+        {
+            if (isCriticalNow(i, length))
+            {
+                critical[i] = 1;
+                criticalList.push_back(i);
+                criticalCount++;
+            }
+        }
+        mark.assign(vertexCount, 0);
+        markValue = 0;
+    }
+
+    // 由当前的ve、remaining判断第i条弧是否为关键活动
+    bool isCriticalNow(int i, int length) const
+    {
+        int from = arcPool[arcCount + i].targetVertex, to = arcPool[i].targetVertex;
+        return vertices[from].earliestStart + arcPool[i].duration + vertices[to].remaining == length;
+    }
+
+    // 更新第i条弧的关键标记，发生变化时记入changed
+    void setCritical(int i, bool now, vector<int> &changed)
+    {
+        if ((critical[i] != 0) == now)
+            return;
+        critical[i] = now;
+        criticalCount += now ? 1 : -1;
+        if (now)
+            criticalList.push_back(i);
+        changed.push_back(i);
+    }
+
+    /**
+     * 沿拓扑序增量传播
+     * @param changes 修改的弧
+     * @param forward true时从弧头出发重算最早发生时间，false时从弧尾出发重算remaining
+     * @param changed 返回值发生变化的顶点
+     */
+    void propagate(const vector<DurationChange> &changes, bool forward, vector<int> &changed)
+    {
+        if (++markValue == 0)
+        {
+            fill(mark.begin(), mark.end(), 0);
+            markValue = 1;
+        }
+        // 小顶堆，关键字为拓扑位置：前向按位置从小到大弹出，反向取相反数从大到小弹出
+        priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> heap;
+        auto push = [&](int v)
+        {
+            if (mark[v] != markValue)
+            {
+                mark[v] = markValue;
+                heap.push(make_pair(forward ? topoPos[v] : -topoPos[v], v));
+            }
+        };
+        for (const DurationChange &c : changes)
+            push(forward ? arcPool[c.arc].targetVertex : arcPool[arcCount + c.arc].targetVertex);
+
+        while (!heap.empty())
+        {
+            int v = heap.top().second;
+            heap.pop();
+            Vertex &vertex = vertices[v];
+            int value = 0;
+            for (ArcNode *arc = forward ? vertex.firstInArc : vertex.firstArc; arc; arc = arc->next)
+            {
+                const Vertex &other = vertices[arc->targetVertex];
+                value = max(value, (forward ? other.earliestStart : other.remaining) + arc->duration);
+            }
+            int &current = forward ? vertex.earliestStart : vertex.remaining;
+            if (value == current)
+                continue;
+            if (forward && !vertex.firstArc)
+            {
+                // 终点的最早发生时间改变，更新终点时间表
+                if (--sinkTimes[current] == 0)
+                    sinkTimes.erase(current);
+                sinkTimes[value]++;
+            }
+            current = value;
+            changed.push_back(v);
+            for (ArcNode *arc = forward ? vertex.firstArc : vertex.firstInArc; arc; arc = arc->next)
+                push(arc->targetVertex);
+        }
+    }
+
+    // 原子地令x = max(x, value)
+    static void atomicMax(int &x, int value)
+    {
+        int cur = __atomic_load_n(&x, __ATOMIC_RELAXED);
+        while (cur < value && !__atomic_compare_exchange_n(&x, &cur, value, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+        }
+    }
+
+    // 获取所有顶点的入度（创建时已统计，复制一份供前向传播递减）
+    vector<int> getInDegrees() const
+    {
+        vector<int> inDegree(vertexCount);
+        for (int i = 0; i < vertexCount; i++)
+        {
+            inDegree[i] = vertices[i].inDegree;
         }
         return inDegree;
     }
 };
 
+// 大规模随机活动网络：弧总是从编号小的事件指向编号大的事件，保证无环
+void largeNetworkDemo(int vCount, int aCount)
+{
+    vector<int> arcs(3 * (size_t)aCount);
+    uint64_t s = 88172645463325252ull;
+    for (int i = 0; i < aCount; i++)
+    {
+        s ^= s << 13;
+        s ^= s >> 7;
+        s ^= s << 17;
+        int u = (int)(s % vCount), v = (int)((s >> 32) % vCount);
+        if (u == v)
+            v = (v + 1) % vCount;
+        arcs[i * 3] = min(u, v);
+        arcs[i * 3 + 1] = max(u, v);
+        arcs[i * 3 + 2] = (int)(s >> 58) + 1;
+    }
+
+    ActivityNetwork network(vCount);
+    network.createNetwork(nullptr, arcs.data(), aCount);
+    auto t0 = chrono::steady_clock::now();
+    network.forwardPropagation();
+    auto t1 = chrono::steady_clock::now();
+    network.backwardPropagation();
+    auto t2 = chrono::steady_clock::now();
+
+    auto ms = [](chrono::steady_clock::time_point a, chrono::steady_clock::time_point b)
+    { return chrono::duration<double, milli>(b - a).count(); };
+    cout << "\n大规模网络：事件数 " << vCount << "，活动数 " << aCount << endl;
+    cout << "前向传播: " << ms(t0, t1) << " ms，反向传播: " << ms(t1, t2) << " ms" << endl;
+    cout << "工期: " << network.projectLength() << "，关键活动数: " << network.countCriticalActivities() << endl;
+
+    CPMResult result;
+    auto t3 = chrono::steady_clock::now();
+    network.parallelCriticalPath(result);
+    auto t4 = chrono::steady_clock::now();
+    int maxSlack = 0;
+    for (int slack : result.slack)
+        maxSlack = max(maxSlack, slack);
+    cout << "并行关键路径分析（" << max(1u, thread::hardware_concurrency()) << " 线程）: " << ms(t3, t4) << " ms，"
+         << result.levels << " 层，工期: " << result.length << "，关键活动数: " << result.criticalArcs.size()
+         << "，最大余量: " << maxSlack << endl;
+
+    // 增量修改10个活动的持续时间，与完整重算比较
+    vector<DurationChange> changes;
+    for (int i = 0; i < 10; i++)
+    {
+        s ^= s << 13;
+        s ^= s >> 7;
+        s ^= s << 17;
+        changes.push_back(DurationChange{(int)(s % aCount), (int)(s >> 58) + 1});
+    }
+    vector<int> changedCritical;
+    auto t5 = chrono::steady_clock::now();
+    network.updateDurations(changes, changedCritical);
+    auto t6 = chrono::steady_clock::now();
+    int length = network.projectLength(), criticalCount = network.countCriticalActivities();
+    network.forwardPropagation();
+    network.backwardPropagation();
+    auto t7 = chrono::steady_clock::now();
+    cout << "增量修改10个活动: " << ms(t5, t6) << " ms，" << changedCritical.size() << " 个活动的关键状态改变；完整重算: "
+         << ms(t6, t7) << " ms，结果" << (length == network.projectLength() && criticalCount == network.countCriticalActivities() ? "一致" : "不一致")
+         << endl;
+}
+
 int main()
 {
     // 创建示例网络
@@ -230,9 +741,24 @@ int main()
     network.createNetwork(vexs, arcs, 15);
 
     // 执行前向传播和反向传播
-    network.forwardPropagation();
-    network.backwardPropagation();
+    if (!network.forwardPropagation(true))
+    {
+        cout << "网中有环" << endl;
+        return 1;
+    }
+    network.backwardPropagation(true);
     network.findCriticalPath();
 
+    // 把A->B（第0条弧）延长到14天，增量更新
+    vector<int> changedCritical;
+    network.updateDurations({DurationChange{0, 14}}, changedCritical);
+    cout << "\nA->B改为14天后，工期: " << network.projectLength() << "，关键状态改变的活动：" << endl;
+    for (int arc : changedCritical)
+    {
+        cout << network.arcName(arc) << (network.isCriticalArc(arc) ? " 成为关键活动" : " 不再是关键活动") << endl;
+    }
+
+    largeNetworkDemo(200000, 1000000);
+
     return 0;
 }
\ No newline at end of file
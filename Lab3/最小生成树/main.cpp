@@ -1,11 +1,11 @@
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
+#include <vector>
 using namespace std;
 
 #define INFINITY 32767
 #define MAX_VERTEX_NUM 20
-#define MAX_EDGE_NUM 20
 
 typedef int Status;
 typedef enum
@@ -43,64 +43,65 @@ typedef struct
     int weight;
 } Edge;
 
-// 并查集数据结构
+// 并查集数据结构：路径减半、按大小合并，集合个数随合并增量维护
+// 可由多个线程并发使用的版本见CSRGraph/include/UnionFind.h
 class UnionFind
 {
 private:
-    int *parent;
-    int size;
+    vector<int> parent;  // 双亲，根的双亲是自己
+    vector<int> setSize; // 以该元素为根的集合大小
+    vector<int> minElem; // 以该元素为根的集合中的最小编号，用作连通分量标识
+    int sets;            // 当前的集合个数
 
 public:
-    UnionFind(int n)
+    UnionFind(int n) : parent(n), setSize(n, 1), minElem(n), sets(n)
     {
-        size = n;
-        parent = new int[n];
         for (int i = 0; i < n; i++)
         {
             parent[i] = i;
+            minElem[i] = i;
         }
     }
 
-    ~UnionFind()
-    {
-        delete[] parent;
-    }
-
-    // 查找根节点（带路径压缩）
+    // 查找根节点（路径减半：把x的双亲改为祖父后跳到祖父）
     int find(int x)
     {
-        if (parent[x] != x)
+        while (parent[x] != x)
         {
-            parent[x] = find(parent[x]);
+            parent[x] = parent[parent[x]];
+            x = parent[x];
         }
-        return parent[x];
+        return x;
     }
 
-    // 合并两个集合
-    void unite(int x, int y)
+    // 合并两个集合：较小的树挂到较大的树下，原来不在同一集合时返回true
+    bool unite(int x, int y)
     {
         int rootX = find(x);
         int rootY = find(y);
-        if (rootX != rootY)
-        {
-            // 总是让大编号指向小编号
-            if (rootX < rootY)
-            {
-                parent[rootY] = rootX;
-            }
-            else
-            {
-                parent[rootX] = rootY;
-            }
-        }
+        if (rootX == rootY)
+            return false;
+        if (setSize[rootX] < setSize[rootY])
+            swap(rootX, rootY);
+        parent[rootY] = rootX;
+        setSize[rootX] += setSize[rootY];
+        minElem[rootX] = min(minElem[rootX], minElem[rootY]);
+        sets--;
+        return true;
     }
 
-    // 获取当前连通分量标识数组
+    // 当前的连通分量个数
+    int count() const
+    {
+        return sets;
+    }
+
+    // 获取当前连通分量标识数组，各分量以其中的最小编号标识
     void getCnvx(int *cnvx)
     {
-        for (int i = 0; i < size; i++)
+        for (int i = 0; i < (int)parent.size(); i++)
         {
-            cnvx[i] = find(i);
+            cnvx[i] = minElem[find(i)];
         }
     }
 };
@@ -158,10 +159,25 @@ void OutMGraph(MGraph G)
     }
 }
 
+// 输出closedge数组中各顶点的lowcost
+static void OutClosedge(const int lowcost[], int n)
+{
+    for (int i = 0; i < n; i++)
+    {
+        if (lowcost[i] == INFINITY)
+            cout << "∞ ";
+        else
+            cout << lowcost[i] << " ";
+    }
+    cout << endl;
+}
+
 // Prim算法实现最小生成树
-void MiniSpanTree_Prim(MGraph G, VertexType u)
+// 返回生成树的边（按加入次序），trace为true时输出每一步选中的边和closedge数组
+// 邻接矩阵上每步都要扫描整行，O(n^2)已是最优；稀疏图请用CSRGraph中基于堆的CSRPrim
+vector<Edge> MiniSpanTree_Prim(const MGraph &G, VertexType u, bool trace = false)
 {
-    cout << "\nPrim算法生成最小生成树：\n";
+    vector<Edge> tree;
     int k = 0;
     // 查找起始顶点的下标
     for (k = 0; k < G.vexnum; k++)
@@ -169,83 +185,79 @@ void MiniSpanTree_Prim(MGraph G, VertexType u)
         if (G.vexs[k] == u)
             break;
     }
+    if (k == G.vexnum)
+        return tree;
 
-    struct
-    {
-        VertexType adjvex;
-        int lowcost;
-    } closedge[MAX_VERTEX_NUM];
+    int adjvex[MAX_VERTEX_NUM];  // 树中与该顶点相连的顶点下标
+    int lowcost[MAX_VERTEX_NUM]; // 到树的最短边的权值，0表示已在树中
 
     // 初始化辅助数组
     for (int i = 0; i < G.vexnum; i++)
     {
-        if (i != k)
-        {
-            closedge[i].adjvex = u;
-            closedge[i].lowcost = G.arcs[k][i].adj;
-        }
+        adjvex[i] = k;
+        lowcost[i] = G.arcs[k][i].adj;
     }
-    closedge[k].lowcost = 0;
+    lowcost[k] = 0;
 
-    cout << "初始closedge数组：";
-    for (int i = 0; i < G.vexnum; i++)
+    if (trace)
     {
-        if (closedge[i].lowcost == INFINITY)
-            cout << "∞ ";
-        else
-            cout << closedge[i].lowcost << " ";
+        cout << "\nPrim算法生成最小生成树：\n";
+        cout << "初始closedge数组：";
+        OutClosedge(lowcost, G.vexnum);
     }
-    cout << endl;
 
     // 选择其余顶点
     for (int i = 1; i < G.vexnum; i++)
     {
         int min = INFINITY;
-        int j = 0;
+        int j = -1;
 
         // 寻找最小边
         for (int w = 0; w < G.vexnum; w++)
         {
-            if (closedge[w].lowcost != 0 && closedge[w].lowcost < min)
+            if (lowcost[w] != 0 && lowcost[w] < min)
             {
-                min = closedge[w].lowcost;
+                min = lowcost[w];
                 j = w;
             }
         }
+        if (j == -1)
+            break; // 图不连通
 
-        cout << "(" << closedge[j].adjvex << "," << G.vexs[j] << ","
-             << closedge[j].lowcost << ")" << endl;
+        tree.push_back(Edge{adjvex[j], j, lowcost[j]});
+        if (trace)
+        {
+            cout << "(" << G.vexs[adjvex[j]] << "," << G.vexs[j] << ","
+                 << lowcost[j] << ")" << endl;
+        }
 
-        closedge[j].lowcost = 0;
+        lowcost[j] = 0;
 
         // 更新最小边
         for (int w = 0; w < G.vexnum; w++)
         {
-            if (G.arcs[j][w].adj < closedge[w].lowcost)
+            if (G.arcs[j][w].adj < lowcost[w])
             {
-                closedge[w].adjvex = G.vexs[j];
-                closedge[w].lowcost = G.arcs[j][w].adj;
+                adjvex[w] = j;
+                lowcost[w] = G.arcs[j][w].adj;
             }
         }
 
-        cout << "更新后的closedge数组：";
-        for (int w = 0; w < G.vexnum; w++)
+        if (trace)
         {
-            if (closedge[w].lowcost == INFINITY)
-                cout << "∞ ";
-            else
-                cout << closedge[w].lowcost << " ";
+            cout << "更新后的closedge数组：";
+            OutClosedge(lowcost, G.vexnum);
         }
-        cout << endl;
     }
+    return tree;
 }
 
-void MiniSpanTree_Kruskal(MGraph G)
+// Kruskal算法实现最小生成树
+// 返回生成树的边（按选中次序），trace为true时输出排序后的边、每次选中的边和连通分量数组
+// 边存放在vector中，边数不受限制；大规模的图请用CSRGraph中的CSRFilterKruskal或CSRBoruvka
+vector<Edge> MiniSpanTree_Kruskal(const MGraph &G, bool trace = false)
 {
-    cout << "\nKruskal算法生成最小生成树：\n";
-    Edge edges[MAX_EDGE_NUM];
-    int edgeCount = 0;
-    int *cnvx = new int[G.vexnum];
+    vector<Edge> edges, tree;
 
     // 收集所有边
     for (int i = 0; i < G.vexnum; i++)
@@ -253,56 +265,54 @@ void MiniSpanTree_Kruskal(MGraph G)
         for (int j = i + 1; j < G.vexnum; j++)
         {
             if (G.arcs[i][j].adj != INFINITY)
-            {
-                edges[edgeCount].begin = i;
-                edges[edgeCount].end = j;
-                edges[edgeCount].weight = G.arcs[i][j].adj;
-                edgeCount++;
-            }
+                edges.push_back(Edge{i, j, G.arcs[i][j].adj});
         }
     }
 
-    sort(edges, edges + edgeCount,
-         [](Edge a, Edge b)
-         { return a.weight < b.weight; });
+    stable_sort(edges.begin(), edges.end(),
+                [](const Edge &a, const Edge &b)
+                { return a.weight < b.weight; });
 
-    cout << "排序后的边：\n";
-    for (int i = 0; i < edgeCount; i++)
+    if (trace)
     {
-        cout << "(" << G.vexs[edges[i].begin] << ","
-             << G.vexs[edges[i].end] << ","
-             << edges[i].weight << ")" << endl;
+        cout << "\nKruskal算法生成最小生成树：\n";
+        cout << "排序后的边：\n";
+        for (const Edge &e : edges)
+        {
+            cout << "(" << G.vexs[e.begin] << ","
+                 << G.vexs[e.end] << ","
+                 << e.weight << ")" << endl;
+        }
     }
 
     UnionFind uf(G.vexnum);
+    vector<int> cnvx(G.vexnum);
 
-    int selectedEdges = 0;
-    for (int i = 0; i < edgeCount && selectedEdges < G.vexnum - 1; i++)
+    for (size_t i = 0; i < edges.size() && uf.count() > 1; i++)
     {
         int begin = edges[i].begin;
         int end = edges[i].end;
 
-        if (uf.find(begin) != uf.find(end))
+        if (uf.unite(begin, end))
         {
-            uf.unite(begin, end);
+            tree.push_back(edges[i]);
+            if (!trace)
+                continue;
             cout << "选中边：(" << G.vexs[begin] << ","
                  << G.vexs[end] << ","
                  << edges[i].weight << ")" << endl;
 
             // 获取并显示连通分量数组
-            uf.getCnvx(cnvx);
+            uf.getCnvx(cnvx.data());
             cout << "连通分量数组 cnvx[]: ";
             for (int j = 0; j < G.vexnum; j++)
             {
                 cout << cnvx[j] << " ";
             }
             cout << endl;
-
-            selectedEdges++;
         }
     }
-
-    delete[] cnvx;
+    return tree;
 }
 int main()
 {
@@ -323,8 +333,16 @@ int main()
 
     CreateMGraph(UDN, G, 6, 10, vexs, arcs);
     OutMGraph(G);
-    MiniSpanTree_Prim(G, 'A');
-    MiniSpanTree_Kruskal(G);
+    vector<Edge> tree = MiniSpanTree_Prim(G, 'A', true);
+    int total = 0;
+    for (const Edge &e : tree)
+        total += e.weight;
+    cout << "Prim生成树共" << tree.size() << "条边，总权值" << total << endl;
+    tree = MiniSpanTree_Kruskal(G, true);
+    total = 0;
+    for (const Edge &e : tree)
+        total += e.weight;
+    cout << "Kruskal生成树共" << tree.size() << "条边，总权值" << total << endl;
 
     return 0;
 }
\ No newline at end of file
@@ -30,13 +30,24 @@ typedef struct VNode
 } VNode, AdjList[MAX_VERTEX_NUM];
 
 // 图的邻接表结构
+// 边结点不再逐个new，而是从图自带的边结点池中顺序分配，销毁图时整块释放
 typedef struct
 {
-    AdjList vertices;   // 顶点数组
-    int vexnum, arcnum; // 顶点数和边数
-    GraphKind kind;     // 图的类型
+    AdjList vertices;      // 顶点数组
+    int vexnum, arcnum;    // 顶点数和边数
+    GraphKind kind;        // 图的类型
+    ArcNode *arcpool;      // 边结点池
+    int poolsize, poolcap; // 池中已分配的和总的边结点数
 } ALGraph;
 
+// 从边结点池中分配一个边结点，池已满时返回nullptr
+ArcNode *NewArcNode(ALGraph &G)
+{
+    if (G.poolsize == G.poolcap)
+        return nullptr;
+    return &G.arcpool[G.poolsize++];
+}
+
 // 创建图的邻接表
 void CreateALGraph(GraphKind GKind, ALGraph &G, int vexnum, int arcnum, char *vexs, int *arcs)
 {
@@ -51,6 +62,11 @@ void CreateALGraph(GraphKind GKind, ALGraph &G, int vexnum, int arcnum, char *ve
         G.vertices[i].firstarc = nullptr;
     }
 
+    // 一次分配全部边结点：无向图/网每条边需要两个
+    G.poolcap = (GKind == UDG || GKind == UDN) ? 2 * arcnum : arcnum;
+    G.poolsize = 0;
+    G.arcpool = new ArcNode[G.poolcap];
+
     // 创建边结点
     for (int k = 0; k < arcnum; k++)
     {
@@ -59,7 +75,7 @@ void CreateALGraph(GraphKind GKind, ALGraph &G, int vexnum, int arcnum, char *ve
         int w = arcs[k * 3 + 2]; // 权值
 
         // 创建边结点i->j
-        ArcNode *p = new ArcNode;
+        ArcNode *p = NewArcNode(G);
         p->adjvex = j;
         p->weight = w;
         p->nextarc = G.vertices[i].firstarc;
@@ -68,7 +84,7 @@ void CreateALGraph(GraphKind GKind, ALGraph &G, int vexnum, int arcnum, char *ve
         // 如果是无向图/网，需要增加边结点j->i
         if (GKind == UDG || GKind == UDN)
         {
-            ArcNode *q = new ArcNode;
+            ArcNode *q = NewArcNode(G);
             q->adjvex = i;
             q->weight = w;
             q->nextarc = G.vertices[j].firstarc;
@@ -77,6 +93,40 @@ void CreateALGraph(GraphKind GKind, ALGraph &G, int vexnum, int arcnum, char *ve
     }
 }
 
+// 紧缩边结点池：把每个顶点的边结点按链表次序搬到连续的位置
+// 建图时边结点按输入次序分配，同一顶点的边结点分散在池中；紧缩后顺着nextarc访问就是顺序访问内存
+void CompactALGraph(ALGraph &G)
+{
+    ArcNode *pool = new ArcNode[G.poolcap];
+    int k = 0;
+    for (int i = 0; i < G.vexnum; i++)
+    {
+        ArcNode *p = G.vertices[i].firstarc;
+        if (!p)
+            continue;
+        G.vertices[i].firstarc = &pool[k];
+        while (p)
+        {
+            pool[k] = *p;
+            pool[k].nextarc = p->nextarc ? &pool[k + 1] : nullptr;
+            k++;
+            p = p->nextarc;
+        }
+    }
+    delete[] G.arcpool;
+    G.arcpool = pool;
+    G.poolsize = k;
+}
+
+// 销毁图：边结点都在池中，整块释放即可，不需要逐条遍历边
+void DestroyALGraph(ALGraph &G)
+{
+    delete[] G.arcpool;
+    G.arcpool = nullptr;
+    G.poolsize = G.poolcap = 0;
+    G.vexnum = G.arcnum = 0;
+}
+
 // 输出图的邻接表
 // 修改输出图的邻接表函数
 void OutALGraph(ALGraph G)
@@ -160,28 +210,59 @@ void VerDegree(ALGraph G)
         }
     }
 }
-// 深度优先遍历的递归函数
-void DFS(ALGraph G, int v, bool visited[])
+// DFS中边(弧)的分类
+typedef enum
+{
+    TREE_EDGE,    // 树边
+    BACK_EDGE,    // 回边：指向祖先
+    FORWARD_EDGE, // 前向边：指向非孩子的后代（仅有向图）
+    CROSS_EDGE    // 横叉边：指向已完成的非后代（仅有向图）
+} EdgeType;
+
+// 带时间戳的深度优先遍历结果
+typedef struct
+{
+    int d[MAX_VERTEX_NUM];      // 发现时间，从1开始
+    int f[MAX_VERTEX_NUM];      // 完成时间
+    int parent[MAX_VERTEX_NUM]; // DFS树中的双亲，根为-1
+    EdgeType *arctype;          // 各边结点的分类，按边结点在池中的下标存放
+} DFSInfo;
+
+// 从顶点v出发深度优先遍历（显式栈，不递归）
+// 栈中保存每个顶点下一条待检查的边结点，访问次序与递归版本相同，顶点再多也不会栈溢出
+void DFS(const ALGraph &G, int v, bool visited[])
 {
-    // 访问当前顶点
+    ArcNode *stackp[MAX_VERTEX_NUM]; // 栈中各顶点下一条待检查的边结点
+    int top = 0;
+
+    // 访问起始顶点
     cout << G.vertices[v].data << " ";
     visited[v] = true;
-
-    // 遍历当前顶点的所有邻接点
-    ArcNode *p = G.vertices[v].firstarc;
-    while (p)
+    stackp[0] = G.vertices[v].firstarc;
+    while (top >= 0)
     {
-        // 如果邻接点未被访问，则递归访问它
-        if (!visited[p->adjvex])
+        ArcNode *p = stackp[top];
+        // 跳过已访问的邻接点
+        while (p && visited[p->adjvex])
+            p = p->nextarc;
+        if (!p)
         {
-            DFS(G, p->adjvex, visited);
+            top--; // 所有邻接点都已访问，回溯
+            continue;
         }
-        p = p->nextarc;
+        stackp[top] = p->nextarc;
+
+        // 访问邻接点并入栈，相当于递归调用
+        int w = p->adjvex;
+        cout << G.vertices[w].data << " ";
+        visited[w] = true;
+        top++;
+        stackp[top] = G.vertices[w].firstarc;
     }
 }
 
 // 深度优先遍历的主函数
-void DFSTraverse(ALGraph G)
+void DFSTraverse(const ALGraph &G)
 {
     cout << "\n深度优先遍历序列：";
     // 初始化访问标记数组
@@ -199,8 +280,112 @@ void DFSTraverse(ALGraph G)
     delete[] visited;
 }
 
+// 带时间戳的深度优先遍历：求发现/完成时间、DFS树并对每条边分类
+// d[v] == 0表示未发现（白色），d[v] > 0且f[v] == 0表示在栈中（灰色），f[v] > 0表示已完成（黑色）
+// 有向图：白色为树边，灰色为回边，黑色且d[v] < d[w]为前向边，否则为横叉边
+// 无向图只有树边和回边：每条边存了两次，回到双亲的那一次是树边的另一半，遇到黑色顶点是回边的另一半
+void DFSTimestamps(const ALGraph &G, DFSInfo &info)
+{
+    bool undirected = (G.kind == UDG || G.kind == UDN);
+    int stackv[MAX_VERTEX_NUM];
+    ArcNode *stackp[MAX_VERTEX_NUM];
+    bool skipped[MAX_VERTEX_NUM]; // 无向图中是否已遇到回到双亲的边
+    int time = 0;
+
+    for (int v = 0; v < G.vexnum; v++)
+    {
+        info.d[v] = info.f[v] = 0;
+        info.parent[v] = -1;
+    }
+    info.arctype = new EdgeType[G.poolsize];
+
+    for (int s = 0; s < G.vexnum; s++)
+    {
+        if (info.d[s])
+            continue;
+        int top = 0;
+        info.d[s] = ++time;
+        stackv[0] = s;
+        stackp[0] = G.vertices[s].firstarc;
+        skipped[s] = false;
+        while (top >= 0)
+        {
+            int v = stackv[top];
+            ArcNode *p = stackp[top];
+            if (!p)
+            {
+                info.f[v] = ++time; // 所有边都已检查，v完成
+                top--;
+                continue;
+            }
+            stackp[top] = p->nextarc;
+
+            int w = p->adjvex;
+            EdgeType &type = info.arctype[p - G.arcpool];
+            if (info.d[w] == 0)
+            {
+                type = TREE_EDGE;
+                info.parent[w] = v;
+                info.d[w] = ++time;
+                top++;
+                stackv[top] = w;
+                stackp[top] = G.vertices[w].firstarc;
+                skipped[w] = false;
+            }
+            else if (undirected)
+            {
+                if (w == info.parent[v] && !skipped[v])
+                {
+                    type = TREE_EDGE;
+                    skipped[v] = true;
+                }
+                else
+                    type = BACK_EDGE;
+            }
+            else if (info.f[w] == 0)
+                type = BACK_EDGE;
+            else if (info.d[v] < info.d[w])
+                type = FORWARD_EDGE;
+            else
+                type = CROSS_EDGE;
+        }
+    }
+}
+
+// 释放边分类数组
+void DestroyDFSInfo(DFSInfo &info)
+{
+    delete[] info.arctype;
+    info.arctype = nullptr;
+}
+
+// 输出时间戳、DFS树和边的分类
+void OutDFSInfo(const ALGraph &G, const DFSInfo &info)
+{
+    const char *names[] = {"树边", "回边", "前向边", "横叉边"};
+    bool undirected = (G.kind == UDG || G.kind == UDN);
+    cout << "\n顶点  发现  完成  双亲" << endl;
+    for (int v = 0; v < G.vexnum; v++)
+    {
+        cout << setw(4) << G.vertices[v].data << setw(6) << info.d[v] << setw(6) << info.f[v] << setw(6)
+             << (info.parent[v] == -1 ? '-' : G.vertices[info.parent[v]].data) << endl;
+    }
+    cout << "边的分类：" << endl;
+    for (int v = 0; v < G.vexnum; v++)
+    {
+        for (ArcNode *p = G.vertices[v].firstarc; p; p = p->nextarc)
+        {
+            // 无向图每条边只输出一次
+            if (undirected && p->adjvex < v)
+                continue;
+            cout << G.vertices[v].data << (undirected ? "-" : "->") << G.vertices[p->adjvex].data << ": "
+                 << names[info.arctype[p - G.arcpool]] << endl;
+        }
+    }
+}
+
 // 广度优先遍历
-void BFSTraverse(ALGraph G)
+void BFSTraverse(const ALGraph &G)
 {
     cout << "\n广度优先遍历序列：";
     // 初始化访问标记数组
@@ -258,6 +443,7 @@ int main()
     // 创建无向图
     cout << "=== 创建无向图 ===\n";
     CreateALGraph(UDG, G, 6, 7, vexs, arcs); // 6个顶点，7条边
+    CompactALGraph(G);                       // 建图完成后紧缩边结点
 
     // 输出邻接表
     OutALGraph(G);
@@ -268,5 +454,31 @@ int main()
     // 广度优先遍历
     BFSTraverse(G);
 
+    // 带时间戳的深度优先遍历
+    DFSInfo info;
+    DFSTimestamps(G, info);
+    OutDFSInfo(G, info);
+    DestroyDFSInfo(info);
+    DestroyALGraph(G);
+
+    // 有向图的边分类：四种边都会出现
+    char vexs2[] = {'A', 'B', 'C', 'D', 'E'};
+    int arcs2[] = {
+        0, 2, 1, // A->C
+        0, 1, 1, // A->B
+        1, 2, 1, // B->C
+        2, 0, 1, // C->A
+        3, 4, 1, // D->E
+        3, 1, 1  // D->B
+    };
+    cout << "\n=== 创建有向图 ===\n";
+    CreateALGraph(DG, G, 5, 6, vexs2, arcs2);
+    CompactALGraph(G);
+    OutALGraph(G);
+    DFSTraverse(G);
+    DFSTimestamps(G, info);
+    OutDFSInfo(G, info);
+    DestroyDFSInfo(info);
+    DestroyALGraph(G);
     return 0;
 }
\ No newline at end of file
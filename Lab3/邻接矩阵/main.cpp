@@ -9,12 +9,14 @@
  ****************************************************************/
 
 #include <iostream>
-#include <iomanip> // 用于格式化输出
+#include <iomanip>   // 用于格式化输出
+#include <algorithm> // 用于min
 using namespace std;
 
 // 常量定义
 #define INFINITY 32767    // 定义无穷大值，用于网中不存在的边
 #define MAX_VERTEX_NUM 20 // 最大顶点数量
+#define DEGREE_BLOCK 64   // 计算度时的分块大小
 
 typedef int Status; // 状态类型定义
 
@@ -122,7 +124,7 @@ void CreateMGraph(GraphKind GKind, MGraph &G, int vexnum, int arcnum, char *vexs
  * @param G: 图结构
  * 输出格式：先输出顶点信息，再输出邻接矩阵
  */
-void OutMGraph(MGraph G)
+void OutMGraph(const MGraph &G)
 {
     cout << "\n图的邻接矩阵：\n";
     // 输出顶点信息
@@ -148,47 +150,72 @@ void OutMGraph(MGraph G)
 }
 
 /**
- * 计算图中各顶点的度
+ * 计算图中各顶点的入度和出度
+ * @param G: 图结构（按引用传递，不复制邻接矩阵）
+ * @param inDegree: 各顶点的入度，至少vexnum项
+ * @param outDegree: 各顶点的出度，至少vexnum项；无向图两者相同，都是度
+ * 只按行扫描一遍矩阵：元素(i,j)是弧时同时累加outDegree[i]和inDegree[j]；
+ * 矩阵按DEGREE_BLOCK大小分块，块内用到的度数组留在缓存中；
+ * 判断是否为弧写成无分支的比较，内层循环可以被编译器向量化
+ */
+void VerDegree(const MGraph &G, int inDegree[], int outDegree[])
+{
+    int n = G.vexnum;
+    for (int i = 0; i < n; i++)
+    {
+        inDegree[i] = 0;
+        outDegree[i] = 0;
+    }
+    for (int i0 = 0; i0 < n; i0 += DEGREE_BLOCK)
+    {
+        int i1 = min(n, i0 + DEGREE_BLOCK);
+        for (int j0 = 0; j0 < n; j0 += DEGREE_BLOCK)
+        {
+            int j1 = min(n, j0 + DEGREE_BLOCK);
+            for (int i = i0; i < i1; i++)
+            {
+                const ArcCell *row = G.arcs[i];
+                int out = 0;
+                for (int j = j0; j < j1; j++)
+                {
+                    // 非零且非INFINITY即为弧
+                    int e = (row[j].adj != 0) & (row[j].adj != INFINITY);
+                    out += e;
+                    inDegree[j] += e;
+                }
+                outDegree[i] += out;
+            }
+        }
+    }
+}
+
+/**
+ * 输出图中各顶点的度
  * @param G: 图结构
- * 对于有向图：分别计算入度、出度和总度数
- * 对于无向图：计算每个顶点的度
+ * 对于有向图：分别输出入度、出度和总度数
+ * 对于无向图：输出每个顶点的度
  */
-void VerDegree(MGraph G)
+void VerDegree(const MGraph &G)
 {
+    int in[MAX_VERTEX_NUM], out[MAX_VERTEX_NUM];
+    VerDegree(G, in, out);
     cout << "\n各顶点的度：\n";
 
     if (G.kind == DG || G.kind == DN)
     {
-        // 有向图或有向网的度计算
+        // 有向图或有向网
         for (int i = 0; i < G.vexnum; i++)
         {
-            int in = 0, out = 0; // 入度和出度计数器
-            for (int j = 0; j < G.vexnum; j++)
-            {
-                // 计算入度：统计第i列非零（非INFINITY）的个数
-                if (G.arcs[j][i].adj != 0 && G.arcs[j][i].adj != INFINITY)
-                    in++;
-                // 计算出度：统计第i行非零（非INFINITY）的个数
-                if (G.arcs[i][j].adj != 0 && G.arcs[i][j].adj != INFINITY)
-                    out++;
-            }
-            cout << "顶点" << G.vexs[i] << "的入度为" << in
-                 << "，出度为" << out << "，总度数为" << (in + out) << endl;
+            cout << "顶点" << G.vexs[i] << "的入度为" << in[i]
+                 << "，出度为" << out[i] << "，总度数为" << (in[i] + out[i]) << endl;
         }
     }
     else
     {
-        // 无向图或无向网的度计算
+        // 无向图或无向网
         for (int i = 0; i < G.vexnum; i++)
         {
-            int degree = 0; // 度计数器
-            for (int j = 0; j < G.vexnum; j++)
-            {
-                // 统计第i行非零（非INFINITY）的个数
-                if (G.arcs[i][j].adj != 0 && G.arcs[i][j].adj != INFINITY)
-                    degree++;
-            }
-            cout << "顶点" << G.vexs[i] << "的度为" << degree << endl;
+            cout << "顶点" << G.vexs[i] << "的度为" << out[i] << endl;
         }
     }
 }
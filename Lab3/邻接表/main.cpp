@@ -1,8 +1,12 @@
 #include <iostream>
 #include <iomanip>
+#include <climits>
+#include <vector>
+#include <ext/pb_ds/priority_queue.hpp>
 using namespace std;
 
 #define MAX_VERTEX_NUM 20
+#define NO_PATH INT_MAX // 不可达顶点的距离
 typedef int Status;
 typedef enum
 {
@@ -29,13 +33,24 @@ typedef struct VNode
 } VNode, AdjList[MAX_VERTEX_NUM];
 
 // 图的邻接表结构
+// 边结点不再逐个new，而是从图自带的边结点池中顺序分配，销毁图时整块释放
 typedef struct
 {
-    AdjList vertices;   // 顶点数组
-    int vexnum, arcnum; // 顶点数和边数
-    GraphKind kind;     // 图的类型
+    AdjList vertices;      // 顶点数组
+    int vexnum, arcnum;    // 顶点数和边数
+    GraphKind kind;        // 图的类型
+    ArcNode *arcpool;      // 边结点池
+    int poolsize, poolcap; // 池中已分配的和总的边结点数
 } ALGraph;
 
+// 从边结点池中分配一个边结点，池已满时返回nullptr
+ArcNode *NewArcNode(ALGraph &G)
+{
+    if (G.poolsize == G.poolcap)
+        return nullptr;
+    return &G.arcpool[G.poolsize++];
+}
+
 // 创建图的邻接表
 void CreateALGraph(GraphKind GKind, ALGraph &G, int vexnum, int arcnum, char *vexs, int *arcs)
 {
@@ -50,6 +65,11 @@ void CreateALGraph(GraphKind GKind, ALGraph &G, int vexnum, int arcnum, char *ve
         G.vertices[i].firstarc = nullptr;
     }
 
+    // 一次分配全部边结点：无向图/网每条边需要两个
+    G.poolcap = (GKind == UDG || GKind == UDN) ? 2 * arcnum : arcnum;
+    G.poolsize = 0;
+    G.arcpool = new ArcNode[G.poolcap];
+
     // 创建边结点
     for (int k = 0; k < arcnum; k++)
     {
@@ -58,7 +78,7 @@ void CreateALGraph(GraphKind GKind, ALGraph &G, int vexnum, int arcnum, char *ve
         int w = arcs[k * 3 + 2]; // 权值
 
         // 创建边结点i->j
-        ArcNode *p = new ArcNode;
+        ArcNode *p = NewArcNode(G);
         p->adjvex = j;
         p->weight = w;
         p->nextarc = G.vertices[i].firstarc;
@@ -67,7 +87,7 @@ void CreateALGraph(GraphKind GKind, ALGraph &G, int vexnum, int arcnum, char *ve
         // 如果是无向图/网，需要增加边结点j->i
         if (GKind == UDG || GKind == UDN)
         {
-            ArcNode *q = new ArcNode;
+            ArcNode *q = NewArcNode(G);
             q->adjvex = i;
             q->weight = w;
             q->nextarc = G.vertices[j].firstarc;
@@ -76,6 +96,40 @@ void CreateALGraph(GraphKind GKind, ALGraph &G, int vexnum, int arcnum, char *ve
     }
 }
 
+// 紧缩边结点池：把每个顶点的边结点按链表次序搬到连续的位置
+// 建图时边结点按输入次序分配，同一顶点的边结点分散在池中；紧缩后顺着nextarc访问就是顺序访问内存
+void CompactALGraph(ALGraph &G)
+{
+    ArcNode *pool = new ArcNode[G.poolcap];
+    int k = 0;
+    for (int i = 0; i < G.vexnum; i++)
+    {
+        ArcNode *p = G.vertices[i].firstarc;
+        if (!p)
+            continue;
+        G.vertices[i].firstarc = &pool[k];
+        while (p)
+        {
+            pool[k] = *p;
+            pool[k].nextarc = p->nextarc ? &pool[k + 1] : nullptr;
+            k++;
+            p = p->nextarc;
+        }
+    }
+    delete[] G.arcpool;
+    G.arcpool = pool;
+    G.poolsize = k;
+}
+
+// 销毁图：边结点都在池中，整块释放即可，不需要逐条遍历边
+void DestroyALGraph(ALGraph &G)
+{
+    delete[] G.arcpool;
+    G.arcpool = nullptr;
+    G.poolsize = G.poolcap = 0;
+    G.vexnum = G.arcnum = 0;
+}
+
 // 输出图的邻接表
 // 修改输出图的邻接表函数
 void OutALGraph(ALGraph G)
@@ -160,6 +214,83 @@ void VerDegree(ALGraph G)
     }
 }
 
+/**
+ * 迪杰斯特拉算法求单源最短路径
+ * @param G 图；无权图每条边的长度为1
+ * @param v0 源点下标
+ * @param dist 各顶点到v0的最短路径长度，不可达为NO_PATH
+ * @param pred 最短路径上的前驱，v0的前驱是自身，不可达为-1
+ * @return 成功返回1；源点越界或有负权边返回-1
+ *
+ * 算法实现:
+ * 1. 用配对堆（__gnu_pbds::priority_queue的pairing_heap_tag）存放尚未确定的顶点，
+ *    插入O(1)，decrease-key通过modify完成且均摊很快，每个顶点在堆中只出现一次。
+ * 2. 弹出距离最小的顶点u，沿邻接表松弛它的边：终点还不在堆中就插入，在堆中且距离变小就modify。
+ * 3. 总复杂度O(E + V log V)（均摊）。
+ */
+Status Dijkstra(const ALGraph &G, int v0, vector<int> &dist, vector<int> &pred)
+{
+    typedef __gnu_pbds::priority_queue<pair<int, int>, greater<pair<int, int>>, __gnu_pbds::pairing_heap_tag> Heap;
+    dist.assign(G.vexnum, NO_PATH);
+    pred.assign(G.vexnum, -1);
+    if (v0 < 0 || v0 >= G.vexnum)
+        return -1;
+
+    Heap heap;
+    vector<Heap::point_iterator> handle(G.vexnum, nullptr); // 各顶点在堆中的位置
+    vector<bool> done(G.vexnum, false);
+    dist[v0] = 0;
+    pred[v0] = v0;
+    handle[v0] = heap.push(make_pair(0, v0));
+    while (!heap.empty())
+    {
+        int u = heap.top().second;
+        heap.pop();
+        handle[u] = nullptr;
+        done[u] = true;
+        for (ArcNode *p = G.vertices[u].firstarc; p; p = p->nextarc)
+        {
+            int w = (G.kind == DN || G.kind == UDN) ? p->weight : 1;
+            if (w < 0)
+                return -1;
+            int v = p->adjvex;
+            if (done[v] || dist[u] + w >= dist[v])
+                continue;
+            dist[v] = dist[u] + w;
+            pred[v] = u;
+            if (handle[v] == nullptr)
+                handle[v] = heap.push(make_pair(dist[v], v));
+            else
+                heap.modify(handle[v], make_pair(dist[v], v));
+        }
+    }
+    return 1;
+}
+
+// 输出从v0出发到各顶点的最短路径
+void OutShortestPath(const ALGraph &G, int v0)
+{
+    vector<int> dist, pred;
+    Dijkstra(G, v0, dist, pred);
+    cout << "\n从" << G.vertices[v0].data << "出发的最短路径：" << endl;
+    for (int v = 0; v < G.vexnum; v++)
+    {
+        cout << G.vertices[v0].data << "->" << G.vertices[v].data << "：";
+        if (dist[v] == NO_PATH)
+        {
+            cout << "不可达" << endl;
+            continue;
+        }
+        vector<int> path;
+        for (int x = v; x != v0; x = pred[x])
+            path.push_back(x);
+        cout << dist[v] << "，路径 " << G.vertices[v0].data;
+        for (int k = (int)path.size() - 1; k >= 0; k--)
+            cout << " " << G.vertices[path[k]].data;
+        cout << endl;
+    }
+}
+
 int main()
 {
     ALGraph G;
@@ -176,8 +307,10 @@ int main()
     };
     cout << "\n=== 创建有向图 ===";
     CreateALGraph(DG, G, 4, 6, vexs1, arcs1);
+    CompactALGraph(G); // 建图完成后紧缩边结点
     OutALGraph(G);
     VerDegree(G);
+    DestroyALGraph(G);
 
     // 2. 测试有向网
     char vexs2[] = {'A', 'B', 'C'};
@@ -187,8 +320,11 @@ int main()
         2, 0, 64};
     cout << "\n=== 创建有向网 ===";
     CreateALGraph(DN, G, 3, 3, vexs2, arcs2);
+    CompactALGraph(G); // 建图完成后紧缩边结点
     OutALGraph(G);
     VerDegree(G);
+    OutShortestPath(G, 1);
+    DestroyALGraph(G);
 
     // 3. 无向网
     char vexs3[] = {'A', 'B', 'C', 'D'};
@@ -202,8 +338,11 @@ int main()
     // 创建无向网
     cout << "\n=== 创建无向网 ===";
     CreateALGraph(UDN, G, 4, 4, vexs3, arcs3); // 4个顶点，4条边
+    CompactALGraph(G); // 建图完成后紧缩边结点
     OutALGraph(G);
     VerDegree(G);
+    OutShortestPath(G, 1);
+    DestroyALGraph(G);
 
     // 4. 无向图
     char vexs4[] = {'A', 'B', 'C', 'D'};
@@ -216,8 +355,10 @@ int main()
     };
     cout << "\n=== 创建无向图 ===";
     CreateALGraph(UDG, G, 4, 5, vexs4, arcs4); // 注意这里改成了5条边
+    CompactALGraph(G); // 建图完成后紧缩边结点
     OutALGraph(G);
     VerDegree(G);
+    DestroyALGraph(G);
 
     return 0;
 }
\ No newline at end of file